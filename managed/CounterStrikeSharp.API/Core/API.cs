@@ -6,30 +6,36 @@ namespace CounterStrikeSharp.API.Core
 {
     public class NativeAPI {
         
+        private static ulong _addListenerIdentifier;
+
         public static bool AddListener(string name, InputArgument callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x8E7D0305);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _addListenerIdentifier, 0x8E7D0305));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _removeListenerIdentifier;
+
         public static bool RemoveListener(string name, InputArgument callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x47C507A2);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _removeListenerIdentifier, 0x47C507A2));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _addCommandIdentifier;
+
         public static void AddCommand(string name, string description, bool serveronly, int flags, InputArgument callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -38,186 +44,218 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(serveronly);
 			ScriptContext.GlobalScriptContext.Push(flags);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x807C6B9C);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _addCommandIdentifier, 0x807C6B9C));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _removeCommandIdentifier;
+
         public static void RemoveCommand(string name, InputArgument callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xEC2412DB);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _removeCommandIdentifier, 0xEC2412DB));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _addCommandListenerIdentifier;
+
         public static void AddCommandListener(string cmd, InputArgument callback, bool post){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(cmd);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(post);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2D2D803D);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _addCommandListenerIdentifier, 0x2D2D803D));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _removeCommandListenerIdentifier;
+
         public static void RemoveCommandListener(string cmd, InputArgument callback, bool post){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(cmd);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(post);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x34DBBF1A);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _removeCommandListenerIdentifier, 0x34DBBF1A));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _commandGetArgCountIdentifier;
+
         public static int CommandGetArgCount(IntPtr command){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(command);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAD28109C);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _commandGetArgCountIdentifier, 0xAD28109C));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _commandGetArgStringIdentifier;
+
         public static string CommandGetArgString(IntPtr command){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(command);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2E52E8EA);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _commandGetArgStringIdentifier, 0x2E52E8EA));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _commandGetCommandStringIdentifier;
+
         public static string CommandGetCommandString(IntPtr command){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(command);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x8FABC059);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _commandGetCommandStringIdentifier, 0x8FABC059));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _commandGetArgByIndexIdentifier;
+
         public static string CommandGetArgByIndex(IntPtr command, int index){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(command);
 			ScriptContext.GlobalScriptContext.Push(index);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x3E8D9805);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _commandGetArgByIndexIdentifier, 0x3E8D9805));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _issueClientCommandIdentifier;
+
         public static void IssueClientCommand(int clientindex, string command){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(clientindex);
 			ScriptContext.GlobalScriptContext.Push(command);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xCA5BA982);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _issueClientCommandIdentifier, 0xCA5BA982));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _findConvarIdentifier;
+
         public static IntPtr FindConvar(string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x52254718);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _findConvarIdentifier, 0x52254718));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _setConvarStringValueIdentifier;
+
         public static void SetConvarStringValue(IntPtr convar, string value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(convar);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x9A736FC1);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setConvarStringValueIdentifier, 0x9A736FC1));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getClientConvarValueIdentifier;
+
         public static string GetClientConvarValue(int clientindex, string convarname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(clientindex);
 			ScriptContext.GlobalScriptContext.Push(convarname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAE4B1B79);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getClientConvarValueIdentifier, 0xAE4B1B79));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _setFakeClientConvarValueIdentifier;
+
         public static void SetFakeClientConvarValue(int clientindex, string convarname, string convarvalue){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(clientindex);
 			ScriptContext.GlobalScriptContext.Push(convarname);
 			ScriptContext.GlobalScriptContext.Push(convarvalue);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x4C61E8BB);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setFakeClientConvarValueIdentifier, 0x4C61E8BB));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _dynamicHookGetReturnIdentifier;
+
         public static T DynamicHookGetReturn<T>(IntPtr hook, int datatype){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(hook);
 			ScriptContext.GlobalScriptContext.Push(datatype);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x4F5B80D0);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _dynamicHookGetReturnIdentifier, 0x4F5B80D0));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
 			}
 		}
 
+        private static ulong _dynamicHookSetReturnIdentifier;
+
         public static void DynamicHookSetReturn<T>(IntPtr hook, int datatype, T value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(hook);
 			ScriptContext.GlobalScriptContext.Push(datatype);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDB297E44);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _dynamicHookSetReturnIdentifier, 0xDB297E44));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _dynamicHookGetParamIdentifier;
+
         public static T DynamicHookGetParam<T>(IntPtr hook, int datatype, int paramindex){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(hook);
 			ScriptContext.GlobalScriptContext.Push(datatype);
 			ScriptContext.GlobalScriptContext.Push(paramindex);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x5F5ABDD5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _dynamicHookGetParamIdentifier, 0x5F5ABDD5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
 			}
 		}
 
+        private static ulong _dynamicHookSetParamIdentifier;
+
         public static void DynamicHookSetParam<T>(IntPtr hook, int datatype, int paramindex, T value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -225,170 +263,202 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(datatype);
 			ScriptContext.GlobalScriptContext.Push(paramindex);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA96CFBC1);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _dynamicHookSetParamIdentifier, 0xA96CFBC1));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getMapNameIdentifier;
+
         public static string GetMapName(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x43C2ED68);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getMapNameIdentifier, 0x43C2ED68));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _getGameDirectoryIdentifier;
+
         public static string GetGameDirectory(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD8F03FD4);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getGameDirectoryIdentifier, 0xD8F03FD4));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _isMapValidIdentifier;
+
         public static bool IsMapValid(string mapname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(mapname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD88A5CD5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _isMapValidIdentifier, 0xD88A5CD5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _getTickIntervalIdentifier;
+
         public static float GetTickInterval(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x970CB1B9);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getTickIntervalIdentifier, 0x970CB1B9));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _getCurrentTimeIdentifier;
+
         public static float GetCurrentTime(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xFDF24F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getCurrentTimeIdentifier, 0xFDF24F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _getTickCountIdentifier;
+
         public static int GetTickCount(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAB744EC5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getTickCountIdentifier, 0xAB744EC5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getGameFrameTimeIdentifier;
+
         public static float GetGameFrameTime(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x97E331CA);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getGameFrameTimeIdentifier, 0x97E331CA));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _getEngineTimeIdentifier;
+
         public static double GetEngineTime(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x39A17C88);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEngineTimeIdentifier, 0x39A17C88));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (double)ScriptContext.GlobalScriptContext.GetResult(typeof(double));
 			}
 		}
 
+        private static ulong _getMaxClientsIdentifier;
+
         public static int GetMaxClients(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x5DF2E20D);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getMaxClientsIdentifier, 0x5DF2E20D));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _issueServerCommandIdentifier;
+
         public static void IssueServerCommand(string command){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(command);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA5901A5E);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _issueServerCommandIdentifier, 0xA5901A5E));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _precacheModelIdentifier;
+
         public static void PrecacheModel(string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x77A0C6BE);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _precacheModelIdentifier, 0x77A0C6BE));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _precacheSoundIdentifier;
+
         public static bool PrecacheSound(string name, bool preload){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(preload);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x758F3FD2);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _precacheSoundIdentifier, 0x758F3FD2));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _isSoundPrecachedIdentifier;
+
         public static bool IsSoundPrecached(string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD4372AF3);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _isSoundPrecachedIdentifier, 0xD4372AF3));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _getSoundDurationIdentifier;
+
         public static float GetSoundDuration(string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x20BB05CE);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSoundDurationIdentifier, 0x20BB05CE));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _createRay1Identifier;
+
         public static IntPtr CreateRay1(int rayType, IntPtr vec1, IntPtr vec2){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(rayType);
 			ScriptContext.GlobalScriptContext.Push(vec1);
 			ScriptContext.GlobalScriptContext.Push(vec2);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x7A3E109A);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createRay1Identifier, 0x7A3E109A));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _createRay2Identifier;
+
         public static IntPtr CreateRay2(IntPtr vec1, IntPtr vec2, IntPtr vec3, IntPtr vec4){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -396,13 +466,15 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(vec2);
 			ScriptContext.GlobalScriptContext.Push(vec3);
 			ScriptContext.GlobalScriptContext.Push(vec4);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x7A3E1099);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createRay2Identifier, 0x7A3E1099));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _traceRayIdentifier;
+
         public static void TraceRay(IntPtr ray, IntPtr ptrace, IntPtr traceFilter, uint flags){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -410,260 +482,308 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(ptrace);
 			ScriptContext.GlobalScriptContext.Push(traceFilter);
 			ScriptContext.GlobalScriptContext.Push(flags);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x35182751);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _traceRayIdentifier, 0x35182751));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _newSimpleTraceFilterIdentifier;
+
         public static IntPtr NewSimpleTraceFilter(int indexToIgnore){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(indexToIgnore);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xC3572E09);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _newSimpleTraceFilterIdentifier, 0xC3572E09));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _newTraceFilterProxyIdentifier;
+
         public static IntPtr NewTraceFilterProxy(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x881F122B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _newTraceFilterProxyIdentifier, 0x881F122B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _traceFilterProxySetTraceTypeCallbackIdentifier;
+
         public static void TraceFilterProxySetTraceTypeCallback(IntPtr traceFilter, IntPtr callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(traceFilter);
 			ScriptContext.GlobalScriptContext.Push(callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xE907BCBA);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _traceFilterProxySetTraceTypeCallbackIdentifier, 0xE907BCBA));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _traceFilterProxySetShouldHitEntityCallbackIdentifier;
+
         public static void TraceFilterProxySetShouldHitEntityCallback(IntPtr traceFilter, IntPtr callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(traceFilter);
 			ScriptContext.GlobalScriptContext.Push(callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x3858171B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _traceFilterProxySetShouldHitEntityCallbackIdentifier, 0x3858171B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _newTraceResultIdentifier;
+
         public static IntPtr NewTraceResult(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x95B04711);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _newTraceResultIdentifier, 0x95B04711));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getTickedTimeIdentifier;
+
         public static double GetTickedTime(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x84108452);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getTickedTimeIdentifier, 0x84108452));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (double)ScriptContext.GlobalScriptContext.GetResult(typeof(double));
 			}
 		}
 
+        private static ulong _queueTaskForNextFrameIdentifier;
+
         public static void QueueTaskForNextFrame(IntPtr callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x9FE394D8);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _queueTaskForNextFrameIdentifier, 0x9FE394D8));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _queueTaskForNextWorldUpdateIdentifier;
+
         public static void QueueTaskForNextWorldUpdate(IntPtr callback){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(callback);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAD51A0C9);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _queueTaskForNextWorldUpdateIdentifier, 0xAD51A0C9));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getValveInterfaceIdentifier;
+
         public static IntPtr GetValveInterface(int interfacetype, string interfacename){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(interfacetype);
 			ScriptContext.GlobalScriptContext.Push(interfacename);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDFAED2BE);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getValveInterfaceIdentifier, 0xDFAED2BE));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getCommandParamValueIdentifier;
+
         public static T GetCommandParamValue<T>(string param, DataType datatype, T defaultvalue){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(param);
 			ScriptContext.GlobalScriptContext.Push(datatype);
 			ScriptContext.GlobalScriptContext.Push(defaultvalue);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x748F302F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getCommandParamValueIdentifier, 0x748F302F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
 			}
 		}
 
+        private static ulong _printToServerConsoleIdentifier;
+
         public static void PrintToServerConsole(string msg){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(msg);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x5D4EE1C2);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _printToServerConsoleIdentifier, 0x5D4EE1C2));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getEntityFromIndexIdentifier;
+
         public static IntPtr GetEntityFromIndex(int index){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(index);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD551EB1F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEntityFromIndexIdentifier, 0xD551EB1F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getUseridFromIndexIdentifier;
+
         public static int GetUseridFromIndex(int index){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(index);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x83542138);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getUseridFromIndexIdentifier, 0x83542138));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getDesignerNameIdentifier;
+
         public static string GetDesignerName(IntPtr pointer){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(pointer);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x28DCCD51);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getDesignerNameIdentifier, 0x28DCCD51));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _getEntityPointerFromHandleIdentifier;
+
         public static IntPtr GetEntityPointerFromHandle(IntPtr entityhandlepointer){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(entityhandlepointer);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xEE3A8DEF);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEntityPointerFromHandleIdentifier, 0xEE3A8DEF));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getRefFromEntityPointerIdentifier;
+
         public static uint GetRefFromEntityPointer(IntPtr entitypointer){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(entitypointer);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAF13DA94);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getRefFromEntityPointerIdentifier, 0xAF13DA94));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (uint)ScriptContext.GlobalScriptContext.GetResult(typeof(uint));
 			}
 		}
 
+        private static ulong _getEntityPointerFromRefIdentifier;
+
         public static IntPtr GetEntityPointerFromRef(uint entityref){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(entityref);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDBC17174);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEntityPointerFromRefIdentifier, 0xDBC17174));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getConcreteEntityListPointerIdentifier;
+
         public static IntPtr GetConcreteEntityListPointer(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x5756DB36);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getConcreteEntityListPointerIdentifier, 0x5756DB36));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _isRefValidEntityIdentifier;
+
         public static bool IsRefValidEntity(uint entityref){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(entityref);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x6E38A1FC);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _isRefValidEntityIdentifier, 0x6E38A1FC));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _printToConsoleIdentifier;
+
         public static void PrintToConsole(int index, string message){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(index);
 			ScriptContext.GlobalScriptContext.Push(message);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x7F033898);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _printToConsoleIdentifier, 0x7F033898));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getFirstActiveEntityIdentifier;
+
         public static IntPtr GetFirstActiveEntity(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x3E50DC41);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getFirstActiveEntityIdentifier, 0x3E50DC41));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getPlayerAuthorizedSteamidIdentifier;
+
         public static ulong GetPlayerAuthorizedSteamid(int slot){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(slot);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD1F30B3B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getPlayerAuthorizedSteamidIdentifier, 0xD1F30B3B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
 			}
 		}
 
+        private static ulong _getPlayerIpAddressIdentifier;
+
         public static string GetPlayerIpAddress(int slot){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(slot);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x46A45CB0);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getPlayerIpAddressIdentifier, 0x46A45CB0));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _hookEntityOutputIdentifier;
+
         public static void HookEntityOutput(string classname, string outputname, InputArgument callback, HookMode mode){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -671,12 +791,14 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(outputname);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(mode);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x15245242);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _hookEntityOutputIdentifier, 0x15245242));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _unhookEntityOutputIdentifier;
+
         public static void UnhookEntityOutput(string classname, string outputname, InputArgument callback, HookMode mode){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -684,273 +806,671 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(outputname);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(mode);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x87DBD139);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _unhookEntityOutputIdentifier, 0x87DBD139));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _hookEntityListenerIdentifier;
+
+        public static void HookEntityListener(int listener, string designername, InputArgument callback){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(listener);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _hookEntityListenerIdentifier, 0x3505DFE3));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _unhookEntityListenerIdentifier;
+
+        public static void UnhookEntityListener(int listener, string designername, InputArgument callback){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(listener);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _unhookEntityListenerIdentifier, 0x53F0AED8));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _getEntityListenerHitsIdentifier;
+
+        public static ulong GetEntityListenerHits(int listener, string designername){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(listener);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEntityListenerHitsIdentifier, 0x2FF9988F));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
+			}
+		}
+
+        private static ulong _getEntitiesByDesignerNameIdentifier;
+
+        public static int GetEntitiesByDesignerName(string designername, bool exact, IntPtr handles, int capacity){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push(exact);
+			ScriptContext.GlobalScriptContext.Push(handles);
+			ScriptContext.GlobalScriptContext.Push(capacity);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEntitiesByDesignerNameIdentifier, 0xE97D2417));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _snapshotEntityFieldsIdentifier;
+
+        public static int SnapshotEntityFields(IntPtr handles, int handlecount, IntPtr fieldpaths, IntPtr widths, IntPtr elementsizes, IntPtr columns, int columncount, IntPtr valid){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(handles);
+			ScriptContext.GlobalScriptContext.Push(handlecount);
+			ScriptContext.GlobalScriptContext.Push(fieldpaths);
+			ScriptContext.GlobalScriptContext.Push(widths);
+			ScriptContext.GlobalScriptContext.Push(elementsizes);
+			ScriptContext.GlobalScriptContext.Push(columns);
+			ScriptContext.GlobalScriptContext.Push(columncount);
+			ScriptContext.GlobalScriptContext.Push(valid);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _snapshotEntityFieldsIdentifier, 0xC4BDE043));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _findEntitiesInRadiusIdentifier;
+
+        public static int FindEntitiesInRadius(IntPtr origin, float radius, string designername, IntPtr handles, int capacity){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(origin);
+			ScriptContext.GlobalScriptContext.Push(radius);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push(handles);
+			ScriptContext.GlobalScriptContext.Push(capacity);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _findEntitiesInRadiusIdentifier, 0x8CE6B3DD));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _findEntitiesInBoxIdentifier;
+
+        public static int FindEntitiesInBox(IntPtr mins, IntPtr maxs, string designername, IntPtr handles, int capacity){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(mins);
+			ScriptContext.GlobalScriptContext.Push(maxs);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push(handles);
+			ScriptContext.GlobalScriptContext.Push(capacity);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _findEntitiesInBoxIdentifier, 0x485B68F0));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _findNearestEntitiesIdentifier;
+
+        public static int FindNearestEntities(IntPtr origin, float maxradius, string designername, IntPtr handles, int count){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(origin);
+			ScriptContext.GlobalScriptContext.Push(maxradius);
+			ScriptContext.GlobalScriptContext.Push(designername);
+			ScriptContext.GlobalScriptContext.Push(handles);
+			ScriptContext.GlobalScriptContext.Push(count);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _findNearestEntitiesIdentifier, 0x634BF887));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _hookEventIdentifier;
+
         public static void HookEvent(string name, InputArgument callback, bool ispost){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(ispost);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xE71F04D5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _hookEventIdentifier, 0xE71F04D5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _unhookEventIdentifier;
+
         public static void UnhookEvent(string name, InputArgument callback, bool ispost){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(ispost);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2154AFAE);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _unhookEventIdentifier, 0x2154AFAE));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _createEventIdentifier;
+
         public static IntPtr CreateEvent(string name, bool force){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(force);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x7B472432);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createEventIdentifier, 0x7B472432));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _fireEventIdentifier;
+
         public static void FireEvent(IntPtr gameevent, bool dontbroadcast){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(dontbroadcast);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2D52AEE);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _fireEventIdentifier, 0x2D52AEE));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _fireEventToClientIdentifier;
+
         public static void FireEventToClient(IntPtr gameevent, int clientindex){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(clientindex);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x40B7C06C);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _fireEventToClientIdentifier, 0x40B7C06C));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getEventNameIdentifier;
+
         public static string GetEventName(IntPtr gameevent){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDFF86998);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventNameIdentifier, 0xDFF86998));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _getEventBoolIdentifier;
+
         public static bool GetEventBool(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDFFEE451);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventBoolIdentifier, 0xDFFEE451));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _getEventIntIdentifier;
+
         public static int GetEventInt(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xB17427CC);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventIntIdentifier, 0xB17427CC));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getEventFloatIdentifier;
+
         public static float GetEventFloat(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xDF96CB6F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventFloatIdentifier, 0xDF96CB6F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _getEventStringIdentifier;
+
         public static string GetEventString(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xB4EBC50A);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventStringIdentifier, 0xB4EBC50A));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
 			}
 		}
 
+        private static ulong _setEventBoolIdentifier;
+
         public static void SetEventBool(IntPtr gameevent, string name, bool value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x31859DC5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventBoolIdentifier, 0x31859DC5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _setEventFloatIdentifier;
+
         public static void SetEventFloat(IntPtr gameevent, string name, float value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x627CF47B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventFloatIdentifier, 0x627CF47B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _setEventStringIdentifier;
+
         public static void SetEventString(IntPtr gameevent, string name, string value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xCB7E7B9E);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventStringIdentifier, 0xCB7E7B9E));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _setEventIntIdentifier;
+
         public static void SetEventInt(IntPtr gameevent, string name, int value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x4F1363D8);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventIntIdentifier, 0x4F1363D8));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _loadEventsFromFileIdentifier;
+
         public static int LoadEventsFromFile(string path, bool searchall){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(path);
 			ScriptContext.GlobalScriptContext.Push(searchall);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xED480293);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _loadEventsFromFileIdentifier, 0xED480293));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getEventPlayerControllerIdentifier;
+
         public static IntPtr GetEventPlayerController(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x88E33F2F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventPlayerControllerIdentifier, 0x88E33F2F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _setEventPlayerControllerIdentifier;
+
         public static void SetEventPlayerController(IntPtr gameevent, string name, IntPtr value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xE8A2033B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventPlayerControllerIdentifier, 0xE8A2033B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _setEventEntityIdentifier;
+
         public static void SetEventEntity(IntPtr gameevent, string name, IntPtr value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAB420F50);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventEntityIdentifier, 0xAB420F50));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _setEventEntityIndexIdentifier;
+
         public static void SetEventEntityIndex(IntPtr gameevent, string name, int value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAF9B1691);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventEntityIndexIdentifier, 0xAF9B1691));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getEventPlayerPawnIdentifier;
+
         public static IntPtr GetEventPlayerPawn(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x80D3545B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventPlayerPawnIdentifier, 0x80D3545B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getEventUint64Identifier;
+
         public static ulong GetEventUint64(IntPtr gameevent, string name){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA5EADD5B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventUint64Identifier, 0xA5EADD5B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
 			}
 		}
 
+        private static ulong _setEventUint64Identifier;
+
         public static void SetEventUint64(IntPtr gameevent, string name, ulong value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(gameevent);
 			ScriptContext.GlobalScriptContext.Push(name);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD0C2D3CF);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventUint64Identifier, 0xD0C2D3CF));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _getEventKeySymbolIdentifier;
+
+        public static int GetEventKeySymbol(string name){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(name);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventKeySymbolIdentifier, 0xEC262351));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _getEventBoolBySymbolIdentifier;
+
+        public static bool GetEventBoolBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventBoolBySymbolIdentifier, 0x2324C4AC));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
+			}
+		}
+
+        private static ulong _getEventIntBySymbolIdentifier;
+
+        public static int GetEventIntBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventIntBySymbolIdentifier, 0x52024131));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _getEventFloatBySymbolIdentifier;
+
+        public static float GetEventFloatBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventFloatBySymbolIdentifier, 0x142983D2));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
+			}
+		}
+
+        private static ulong _getEventStringBySymbolIdentifier;
+
+        public static string GetEventStringBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventStringBySymbolIdentifier, 0x97B467F7));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (string)ScriptContext.GlobalScriptContext.GetResult(typeof(string));
+			}
+		}
+
+        private static ulong _getEventUint64BySymbolIdentifier;
+
+        public static ulong GetEventUint64BySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventUint64BySymbolIdentifier, 0xF25AF326));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
+			}
+		}
+
+        private static ulong _getEventPlayerControllerBySymbolIdentifier;
+
+        public static IntPtr GetEventPlayerControllerBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventPlayerControllerBySymbolIdentifier, 0xC1B09492));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
+			}
+		}
+
+        private static ulong _getEventPlayerPawnBySymbolIdentifier;
+
+        public static IntPtr GetEventPlayerPawnBySymbol(IntPtr gameevent, int symbol){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEventPlayerPawnBySymbolIdentifier, 0xA7842A26));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
+			}
+		}
+
+        private static ulong _setEventBoolBySymbolIdentifier;
+
+        public static void SetEventBoolBySymbol(IntPtr gameevent, int symbol, bool value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventBoolBySymbolIdentifier, 0x989EF638));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setEventIntBySymbolIdentifier;
+
+        public static void SetEventIntBySymbol(IntPtr gameevent, int symbol, int value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventIntBySymbolIdentifier, 0x25BEE525));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setEventFloatBySymbolIdentifier;
+
+        public static void SetEventFloatBySymbol(IntPtr gameevent, int symbol, float value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventFloatBySymbolIdentifier, 0x707954C6));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setEventStringBySymbolIdentifier;
+
+        public static void SetEventStringBySymbol(IntPtr gameevent, int symbol, string value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventStringBySymbolIdentifier, 0x86B74663));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setEventUint64BySymbolIdentifier;
+
+        public static void SetEventUint64BySymbol(IntPtr gameevent, int symbol, ulong value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventUint64BySymbolIdentifier, 0xF196A1B2));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setEventPlayerControllerBySymbolIdentifier;
+
+        public static void SetEventPlayerControllerBySymbol(IntPtr gameevent, int symbol, IntPtr value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbol);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setEventPlayerControllerBySymbolIdentifier, 0xA96C086));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _readEventFieldsIdentifier;
+
+        public static void ReadEventFields(IntPtr gameevent, IntPtr symbols, IntPtr types, int count, IntPtr values){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(gameevent);
+			ScriptContext.GlobalScriptContext.Push(symbols);
+			ScriptContext.GlobalScriptContext.Push(types);
+			ScriptContext.GlobalScriptContext.Push(count);
+			ScriptContext.GlobalScriptContext.Push(values);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _readEventFieldsIdentifier, 0x4F9EC96A));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getLiveEventCountIdentifier;
+
+        public static int GetLiveEventCount(){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getLiveEventCountIdentifier, 0x1D226A95));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
+			}
+		}
+
+        private static ulong _createVirtualFunctionIdentifier;
+
         public static IntPtr CreateVirtualFunction(IntPtr pointer, int vtableoffset, int numarguments, int returntype, object[] arguments){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -962,13 +1482,15 @@ namespace CounterStrikeSharp.API.Core
 			{
 				ScriptContext.GlobalScriptContext.Push(obj);
 			}
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2531DA2);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createVirtualFunctionIdentifier, 0x2531DA2));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _createVirtualFunctionBySignatureIdentifier;
+
         public static IntPtr CreateVirtualFunctionBySignature(IntPtr pointer, string binaryname, string signature, int numarguments, int returntype, object[] arguments){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -981,37 +1503,43 @@ namespace CounterStrikeSharp.API.Core
 			{
 				ScriptContext.GlobalScriptContext.Push(obj);
 			}
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x8D25187D);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createVirtualFunctionBySignatureIdentifier, 0x8D25187D));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _hookFunctionIdentifier;
+
         public static void HookFunction(IntPtr function, InputArgument hook, bool post){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(function);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)hook);
 			ScriptContext.GlobalScriptContext.Push(post);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA6C8BA9B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _hookFunctionIdentifier, 0xA6C8BA9B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _unhookFunctionIdentifier;
+
         public static void UnhookFunction(IntPtr function, InputArgument hook, bool post){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(function);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)hook);
 			ScriptContext.GlobalScriptContext.Push(post);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2051B00);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _unhookFunctionIdentifier, 0x2051B00));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _executeVirtualFunctionIdentifier;
+
         public static T ExecuteVirtualFunction<T>(IntPtr function, object[] arguments){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -1020,72 +1548,84 @@ namespace CounterStrikeSharp.API.Core
 			{
 				ScriptContext.GlobalScriptContext.Push(obj);
 			}
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x376A0359);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _executeVirtualFunctionIdentifier, 0x376A0359));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
 			}
 		}
 
+        private static ulong _findSignatureIdentifier;
+
         public static IntPtr FindSignature(string modulepath, string signature){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(modulepath);
 			ScriptContext.GlobalScriptContext.Push(signature);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xE9E1819B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _findSignatureIdentifier, 0xE9E1819B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getNetworkVectorSizeIdentifier;
+
         public static int GetNetworkVectorSize(IntPtr vec){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vec);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA585F34E);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getNetworkVectorSizeIdentifier, 0xA585F34E));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getNetworkVectorElementAtIdentifier;
+
         public static IntPtr GetNetworkVectorElementAt(IntPtr vec, int index){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vec);
 			ScriptContext.GlobalScriptContext.Push(index);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x67A31E3F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getNetworkVectorElementAtIdentifier, 0x67A31E3F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _getSchemaOffsetIdentifier;
+
         public static short GetSchemaOffset(string classname, string propname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(classname);
 			ScriptContext.GlobalScriptContext.Push(propname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x57B77D8F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSchemaOffsetIdentifier, 0x57B77D8F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (short)ScriptContext.GlobalScriptContext.GetResult(typeof(short));
 			}
 		}
 
+        private static ulong _isSchemaFieldNetworkedIdentifier;
+
         public static bool IsSchemaFieldNetworked(string classname, string propname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(classname);
 			ScriptContext.GlobalScriptContext.Push(propname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xFE413B0C);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _isSchemaFieldNetworkedIdentifier, 0xFE413B0C));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _getSchemaValueByNameIdentifier;
+
         public static T GetSchemaValueByName<T>(IntPtr instance, int returntype, string classname, string propname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -1093,13 +1633,15 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(returntype);
 			ScriptContext.GlobalScriptContext.Push(classname);
 			ScriptContext.GlobalScriptContext.Push(propname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD01E4EB5);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSchemaValueByNameIdentifier, 0xD01E4EB5));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
 			}
 		}
 
+        private static ulong _setSchemaValueByNameIdentifier;
+
         public static void SetSchemaValueByName<T>(IntPtr instance, int returntype, string classname, string propname, T value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -1108,164 +1650,306 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(classname);
 			ScriptContext.GlobalScriptContext.Push(propname);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xAB9AA921);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setSchemaValueByNameIdentifier, 0xAB9AA921));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getSchemaClassSizeIdentifier;
+
         public static int GetSchemaClassSize(string classname){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(classname);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x9CE4FC56);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSchemaClassSizeIdentifier, 0x9CE4FC56));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (int)ScriptContext.GlobalScriptContext.GetResult(typeof(int));
 			}
 		}
 
+        private static ulong _getSchemaFieldTokenIdentifier;
+
+        public static uint GetSchemaFieldToken(string classname, string propname, int datatype){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(classname);
+			ScriptContext.GlobalScriptContext.Push(propname);
+			ScriptContext.GlobalScriptContext.Push(datatype);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSchemaFieldTokenIdentifier, 0x4E976184));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (uint)ScriptContext.GlobalScriptContext.GetResult(typeof(uint));
+			}
+		}
+
+        private static ulong _getSchemaValueByTokenIdentifier;
+
+        public static T GetSchemaValueByToken<T>(IntPtr instance, uint token){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(instance);
+			ScriptContext.GlobalScriptContext.Push(token);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getSchemaValueByTokenIdentifier, 0xD29F4CC9));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (T)ScriptContext.GlobalScriptContext.GetResult(typeof(T));
+			}
+		}
+
+        private static ulong _setSchemaValueByTokenIdentifier;
+
+        public static void SetSchemaValueByToken<T>(IntPtr instance, uint token, T value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(instance);
+			ScriptContext.GlobalScriptContext.Push(token);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setSchemaValueByTokenIdentifier, 0x1FEE45DD));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setSchemaValueAndNotifyIdentifier;
+
+        public static void SetSchemaValueAndNotify<T>(IntPtr instance, uint token, T value){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(instance);
+			ScriptContext.GlobalScriptContext.Push(token);
+			ScriptContext.GlobalScriptContext.Push(value);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setSchemaValueAndNotifyIdentifier, 0x5E59E8D5));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			}
+		}
+
+        private static ulong _setStateChangedIdentifier;
+
+        public static bool SetStateChanged(IntPtr instance, string classname, string propname, int extraoffset){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(instance);
+			ScriptContext.GlobalScriptContext.Push(classname);
+			ScriptContext.GlobalScriptContext.Push(propname);
+			ScriptContext.GlobalScriptContext.Push(extraoffset);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setStateChangedIdentifier, 0x14A5032));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
+			}
+		}
+
+        private static ulong _getStateChangesRequestedIdentifier;
+
+        public static ulong GetStateChangesRequested(){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getStateChangesRequestedIdentifier, 0x6E83DBDE));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
+			}
+		}
+
+        private static ulong _getStateChangesSavedIdentifier;
+
+        public static ulong GetStateChangesSaved(){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getStateChangesSavedIdentifier, 0x53BB76CB));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (ulong)ScriptContext.GlobalScriptContext.GetResult(typeof(ulong));
+			}
+		}
+
+        private static ulong _getEconItemSystemIdentifier;
+
         public static IntPtr GetEconItemSystem(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x981E9B5B);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getEconItemSystemIdentifier, 0x981E9B5B));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _isServerPausedIdentifier;
+
         public static bool IsServerPaused(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xB216AAAC);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _isServerPausedIdentifier, 0xB216AAAC));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _createTimerIdentifier;
+
         public static IntPtr CreateTimer(float interval, InputArgument callback, int flags){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(interval);
 			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
 			ScriptContext.GlobalScriptContext.Push(flags);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x7A5BAE39);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createTimerIdentifier, 0x7A5BAE39));
+			ScriptContext.GlobalScriptContext.Invoke();
+			ScriptContext.GlobalScriptContext.CheckErrors();
+			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
+			}
+		}
+
+        private static ulong _createTickTimerIdentifier;
+
+        public static IntPtr CreateTickTimer(int ticks, InputArgument callback, int flags){
+			lock (ScriptContext.GlobalScriptContext.Lock) {
+			ScriptContext.GlobalScriptContext.Reset();
+			ScriptContext.GlobalScriptContext.Push(ticks);
+			ScriptContext.GlobalScriptContext.Push((InputArgument)callback);
+			ScriptContext.GlobalScriptContext.Push(flags);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _createTickTimerIdentifier, 0x7225FDF3));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _killTimerIdentifier;
+
         public static void KillTimer(IntPtr timer){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(timer);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x32313EDF);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _killTimerIdentifier, 0x32313EDF));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _vectorNewIdentifier;
+
         public static IntPtr VectorNew(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA67981DF);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorNewIdentifier, 0xA67981DF));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _angleNewIdentifier;
+
         public static IntPtr AngleNew(){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x11907167);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _angleNewIdentifier, 0x11907167));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (IntPtr)ScriptContext.GlobalScriptContext.GetResult(typeof(IntPtr));
 			}
 		}
 
+        private static ulong _vectorGetXIdentifier;
+
         public static float VectorGetX(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2A85CBB2);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorGetXIdentifier, 0x2A85CBB2));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorGetYIdentifier;
+
         public static float VectorGetY(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2A85CBB3);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorGetYIdentifier, 0x2A85CBB3));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorGetZIdentifier;
+
         public static float VectorGetZ(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2A85CBB0);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorGetZIdentifier, 0x2A85CBB0));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorSetXIdentifier;
+
         public static void VectorSetX(IntPtr vector, float value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2B62AFA6);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorSetXIdentifier, 0x2B62AFA6));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _vectorSetYIdentifier;
+
         public static void VectorSetY(IntPtr vector, float value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2B62AFA7);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorSetYIdentifier, 0x2B62AFA7));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _vectorSetZIdentifier;
+
         public static void VectorSetZ(IntPtr vector, float value){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
 			ScriptContext.GlobalScriptContext.Push(value);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x2B62AFA4);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorSetZIdentifier, 0x2B62AFA4));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _vectorAnglesIdentifier;
+
         public static void VectorAngles(IntPtr vector, IntPtr pseudoup, IntPtr outangle){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
 			ScriptContext.GlobalScriptContext.Push(pseudoup);
 			ScriptContext.GlobalScriptContext.Push(outangle);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x6E6886B1);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorAnglesIdentifier, 0x6E6886B1));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _angleVectorsIdentifier;
+
         public static void AngleVectors(IntPtr vector, IntPtr forwardout, IntPtr rightout, IntPtr upout){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
@@ -1273,107 +1957,125 @@ namespace CounterStrikeSharp.API.Core
 			ScriptContext.GlobalScriptContext.Push(forwardout);
 			ScriptContext.GlobalScriptContext.Push(rightout);
 			ScriptContext.GlobalScriptContext.Push(upout);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xF696A2F1);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _angleVectorsIdentifier, 0xF696A2F1));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _vectorLengthIdentifier;
+
         public static float VectorLength(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x94B5BA5F);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorLengthIdentifier, 0x94B5BA5F));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorLength2dIdentifier;
+
         public static float VectorLength2d(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xBAC81CD6);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorLength2dIdentifier, 0xBAC81CD6));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorLengthSqrIdentifier;
+
         public static float VectorLengthSqr(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x13CB3150);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorLengthSqrIdentifier, 0x13CB3150));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorLength2dSqrIdentifier;
+
         public static float VectorLength2dSqr(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xEAF6FE79);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorLength2dSqrIdentifier, 0xEAF6FE79));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (float)ScriptContext.GlobalScriptContext.GetResult(typeof(float));
 			}
 		}
 
+        private static ulong _vectorIsZeroIdentifier;
+
         public static bool VectorIsZero(IntPtr vector){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(vector);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xA4B37BC4);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _vectorIsZeroIdentifier, 0xA4B37BC4));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (bool)ScriptContext.GlobalScriptContext.GetResult(typeof(bool));
 			}
 		}
 
+        private static ulong _setClientListeningIdentifier;
+
         public static void SetClientListening(IntPtr receiver, IntPtr sender, uint listen){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(receiver);
 			ScriptContext.GlobalScriptContext.Push(sender);
 			ScriptContext.GlobalScriptContext.Push(listen);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xD38BEE77);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setClientListeningIdentifier, 0xD38BEE77));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getClientListeningIdentifier;
+
         public static ListenOverride GetClientListening(IntPtr receiver, IntPtr sender){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(receiver);
 			ScriptContext.GlobalScriptContext.Push(sender);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0xE95644E3);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getClientListeningIdentifier, 0xE95644E3));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (ListenOverride)ScriptContext.GlobalScriptContext.GetResult(typeof(ListenOverride));
 			}
 		}
 
+        private static ulong _setClientVoiceFlagsIdentifier;
+
         public static void SetClientVoiceFlags(IntPtr client, uint flags){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(client);
 			ScriptContext.GlobalScriptContext.Push(flags);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x48EB2FC8);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _setClientVoiceFlagsIdentifier, 0x48EB2FC8));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			}
 		}
 
+        private static ulong _getClientVoiceFlagsIdentifier;
+
         public static uint GetClientVoiceFlags(IntPtr client){
 			lock (ScriptContext.GlobalScriptContext.Lock) {
 			ScriptContext.GlobalScriptContext.Reset();
 			ScriptContext.GlobalScriptContext.Push(client);
-			ScriptContext.GlobalScriptContext.SetIdentifier(0x9685205C);
+			ScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref _getClientVoiceFlagsIdentifier, 0x9685205C));
 			ScriptContext.GlobalScriptContext.Invoke();
 			ScriptContext.GlobalScriptContext.CheckErrors();
 			return (uint)ScriptContext.GlobalScriptContext.GetResult(typeof(uint));
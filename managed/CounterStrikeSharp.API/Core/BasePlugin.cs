@@ -126,6 +126,9 @@ namespace CounterStrikeSharp.API.Core
         internal readonly Dictionary<Delegate, EntityIO.EntityOutputCallback> EntitySingleOutputHooks =
             new Dictionary<Delegate, EntityIO.EntityOutputCallback>();
 
+        public readonly Dictionary<(EntityListenerType Type, string DesignerName, Delegate Handler), CallbackSubscriber> EntityListenerHooks =
+            new Dictionary<(EntityListenerType Type, string DesignerName, Delegate Handler), CallbackSubscriber>();
+
         public readonly List<Timer> Timers = new List<Timer>();
         
         public delegate HookResult GameEventHandler<T>(T @event, GameEventInfo info) where T : GameEvent;
@@ -388,6 +391,28 @@ namespace CounterStrikeSharp.API.Core
             return timer;
         }
 
+        /// <summary>
+        /// Adds a timer that fires after <paramref name="ticks"/> server ticks, or every <paramref name="ticks"/> ticks
+        /// when <see cref="TimerFlags.REPEAT"/> is set.
+        /// </summary>
+        public Timer AddTickTimer(int ticks, Action callback, TimerFlags? flags = null)
+        {
+            var timer = Timer.FromTicks(ticks, callback, flags ?? 0);
+            Timers.Add(timer);
+            return timer;
+        }
+
+        /// <summary>
+        /// Adds a once-off timer that fires on server tick <paramref name="tick"/> (see <see cref="Server.TickCount"/>).
+        /// Ticks that have already passed fire on the next frame.
+        /// </summary>
+        public Timer AddTimerAtTick(int tick, Action callback, TimerFlags? flags = null)
+        {
+            var timer = Timer.FromTicks(tick - Server.TickCount, callback, (flags ?? 0) & ~TimerFlags.REPEAT);
+            Timers.Add(timer);
+            return timer;
+        }
+
 
         public void RegisterAllAttributes(object instance)
         {
@@ -541,6 +566,41 @@ namespace CounterStrikeSharp.API.Core
             EntitySingleOutputHooks.Remove(handler);
         }
 
+        /// <summary>
+        /// Hooks an entity lifecycle stage, but only for entities whose designer name matches
+        /// <paramref name="designerName"/>. The name may contain <c>*</c> and <c>?</c> wildcards and is matched
+        /// in native code, so entities that do not match never reach managed code.
+        /// </summary>
+        /// <param name="type">The lifecycle stage to listen to.</param>
+        /// <param name="designerName">Designer name or wildcard pattern, e.g. <c>weapon_*</c>.</param>
+        /// <param name="handler">The callback invoked for every matching entity.</param>
+        public void HookEntityListener(EntityListenerType type, string designerName, EntityListener.EntityListenerHandler handler)
+        {
+            var subscriber = new CallbackSubscriber(handler, handler,
+                () => UnhookEntityListener(type, designerName, handler));
+
+            NativeAPI.HookEntityListener((int)type, designerName, subscriber.GetInputArgument());
+            EntityListenerHooks[(type, designerName, handler)] = subscriber;
+        }
+
+        public void UnhookEntityListener(EntityListenerType type, string designerName, EntityListener.EntityListenerHandler handler)
+        {
+            if (!EntityListenerHooks.TryGetValue((type, designerName, handler), out var subscriber)) return;
+
+            NativeAPI.UnhookEntityListener((int)type, designerName, subscriber.GetInputArgument());
+            FunctionReference.Remove(subscriber.GetReferenceIdentifier());
+            EntityListenerHooks.Remove((type, designerName, handler));
+        }
+
+        /// <summary>
+        /// Number of entities that matched a hooked entity listener filter. The counter is shared by every
+        /// plugin hooking the same filter and resets once the last handler is unhooked.
+        /// </summary>
+        public static ulong GetEntityListenerHits(EntityListenerType type, string designerName)
+        {
+            return NativeAPI.GetEntityListenerHits((int)type, designerName);
+        }
+
         public void Dispose()
         {
             Dispose(true);
@@ -580,6 +640,11 @@ namespace CounterStrikeSharp.API.Core
                 subscriber.Dispose();
             }
 
+            foreach (var subscriber in EntityListenerHooks.Values)
+            {
+                subscriber.Dispose();
+            }
+
             foreach (var timer in Timers)
             {
                 timer.Kill();
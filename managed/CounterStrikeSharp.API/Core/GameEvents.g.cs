@@ -16,18 +16,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // entindex of the player
+                private static readonly GameEventKey _keyPlayer = new("player");
                 public CCSPlayerController Player 
                 {
-                    get => Get<CCSPlayerController>("player");
-                    set => Set<CCSPlayerController>("player", value);
+                    get => Get<CCSPlayerController>(_keyPlayer);
+                    set => Set<CCSPlayerController>(_keyPlayer, value);
                 }
 
                 
                 // achievement ID
+                private static readonly GameEventKey _keyAchievement = new("achievement");
                 public int Achievement 
                 {
-                    get => Get<int>("achievement");
-                    set => Set<int>("achievement", value);
+                    get => Get<int>(_keyAchievement);
+                    set => Set<int>(_keyAchievement, value);
                 }
             }
 
@@ -40,18 +42,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // achievement ID
+                private static readonly GameEventKey _keyAchievement = new("achievement");
                 public int Achievement 
                 {
-                    get => Get<int>("achievement");
-                    set => Set<int>("achievement", value);
+                    get => Get<int>(_keyAchievement);
+                    set => Set<int>(_keyAchievement, value);
                 }
 
                 
                 // splitscreen ID
+                private static readonly GameEventKey _keySplitscreenplayer = new("splitscreenplayer");
                 public int Splitscreenplayer 
                 {
-                    get => Get<int>("splitscreenplayer");
-                    set => Set<int>("splitscreenplayer", value);
+                    get => Get<int>(_keySplitscreenplayer);
+                    set => Set<int>(_keySplitscreenplayer, value);
                 }
             }
 
@@ -64,26 +68,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // non-localized name of achievement
+                private static readonly GameEventKey _keyAchievementName = new("achievement_name");
                 public string AchievementName 
                 {
-                    get => Get<string>("achievement_name");
-                    set => Set<string>("achievement_name", value);
+                    get => Get<string>(_keyAchievementName);
+                    set => Set<string>(_keyAchievementName, value);
                 }
 
                 
                 // # of steps toward achievement
+                private static readonly GameEventKey _keyCurVal = new("cur_val");
                 public int CurVal 
                 {
-                    get => Get<int>("cur_val");
-                    set => Set<int>("cur_val", value);
+                    get => Get<int>(_keyCurVal);
+                    set => Set<int>(_keyCurVal, value);
                 }
 
                 
                 // total # of steps in achievement
+                private static readonly GameEventKey _keyMaxVal = new("max_val");
                 public int MaxVal 
                 {
-                    get => Get<int>("max_val");
-                    set => Set<int>("max_val", value);
+                    get => Get<int>(_keyMaxVal);
+                    set => Set<int>(_keyMaxVal, value);
                 }
             }
 
@@ -114,98 +121,110 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBone = new("bone");
                 public int Bone 
                 {
-                    get => Get<int>("bone");
-                    set => Set<int>("bone", value);
+                    get => Get<int>(_keyBone);
+                    set => Set<int>(_keyBone, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosX = new("pos_x");
                 public int PosX 
                 {
-                    get => Get<int>("pos_x");
-                    set => Set<int>("pos_x", value);
+                    get => Get<int>(_keyPosX);
+                    set => Set<int>(_keyPosX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosY = new("pos_y");
                 public int PosY 
                 {
-                    get => Get<int>("pos_y");
-                    set => Set<int>("pos_y", value);
+                    get => Get<int>(_keyPosY);
+                    set => Set<int>(_keyPosY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosZ = new("pos_z");
                 public int PosZ 
                 {
-                    get => Get<int>("pos_z");
-                    set => Set<int>("pos_z", value);
+                    get => Get<int>(_keyPosZ);
+                    set => Set<int>(_keyPosZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngX = new("ang_x");
                 public int AngX 
                 {
-                    get => Get<int>("ang_x");
-                    set => Set<int>("ang_x", value);
+                    get => Get<int>(_keyAngX);
+                    set => Set<int>(_keyAngX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngY = new("ang_y");
                 public int AngY 
                 {
-                    get => Get<int>("ang_y");
-                    set => Set<int>("ang_y", value);
+                    get => Get<int>(_keyAngY);
+                    set => Set<int>(_keyAngY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngZ = new("ang_z");
                 public int AngZ 
                 {
-                    get => Get<int>("ang_z");
-                    set => Set<int>("ang_z", value);
+                    get => Get<int>(_keyAngZ);
+                    set => Set<int>(_keyAngZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartX = new("start_x");
                 public int StartX 
                 {
-                    get => Get<int>("start_x");
-                    set => Set<int>("start_x", value);
+                    get => Get<int>(_keyStartX);
+                    set => Set<int>(_keyStartX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartY = new("start_y");
                 public int StartY 
                 {
-                    get => Get<int>("start_y");
-                    set => Set<int>("start_y", value);
+                    get => Get<int>(_keyStartY);
+                    set => Set<int>(_keyStartY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartZ = new("start_z");
                 public int StartZ 
                 {
-                    get => Get<int>("start_z");
-                    set => Set<int>("start_z", value);
+                    get => Get<int>(_keyStartZ);
+                    set => Set<int>(_keyStartZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHit = new("hit");
                 public bool Hit 
                 {
-                    get => Get<bool>("hit");
-                    set => Set<bool>("hit", value);
+                    get => Get<bool>(_keyHit);
+                    set => Set<bool>(_keyHit, value);
                 }
             }
 
@@ -218,34 +237,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosX = new("pos_x");
                 public float PosX 
                 {
-                    get => Get<float>("pos_x");
-                    set => Set<float>("pos_x", value);
+                    get => Get<float>(_keyPosX);
+                    set => Set<float>(_keyPosX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosY = new("pos_y");
                 public float PosY 
                 {
-                    get => Get<float>("pos_y");
-                    set => Set<float>("pos_y", value);
+                    get => Get<float>(_keyPosY);
+                    set => Set<float>(_keyPosY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosZ = new("pos_z");
                 public float PosZ 
                 {
-                    get => Get<float>("pos_z");
-                    set => Set<float>("pos_z", value);
+                    get => Get<float>(_keyPosZ);
+                    set => Set<float>(_keyPosZ, value);
                 }
             }
 
@@ -258,26 +281,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // either a weapon such as 'tmp' or 'hegrenade', or an item such as 'nvgs'
+                private static readonly GameEventKey _keyItem = new("item");
                 public string Item 
                 {
-                    get => Get<string>("item");
-                    set => Set<string>("item", value);
+                    get => Get<string>(_keyItem);
+                    set => Set<string>(_keyItem, value);
                 }
 
                 
                 // the weapon entindex
+                private static readonly GameEventKey _keyIndex = new("index");
                 public long Index 
                 {
-                    get => Get<long>("index");
-                    set => Set<long>("index", value);
+                    get => Get<long>(_keyIndex);
+                    set => Set<long>(_keyIndex, value);
                 }
             }
 
@@ -290,18 +316,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySuccess = new("success");
                 public bool Success 
                 {
-                    get => Get<bool>("success");
-                    set => Set<bool>("success", value);
+                    get => Get<bool>(_keySuccess);
+                    set => Set<bool>(_keySuccess, value);
                 }
             }
 
@@ -332,10 +360,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who was defusing
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -348,18 +377,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who is planting the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // bombsite index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -372,10 +403,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // c4 entity
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -388,18 +420,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who is defusing
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHaskit = new("haskit");
                 public bool Haskit 
                 {
-                    get => Get<bool>("haskit");
-                    set => Set<bool>("haskit", value);
+                    get => Get<bool>(_keyHaskit);
+                    set => Set<bool>(_keyHaskit, value);
                 }
             }
 
@@ -412,18 +446,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who is planting the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // bombsite index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -436,18 +472,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who defused the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // bombsite index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -460,18 +498,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who dropped the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -484,18 +524,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who planted the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // bombsite index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -508,10 +550,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player pawn who picked up the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -524,18 +567,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who planted the bomb
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // bombsite index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -548,34 +593,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyNumadvanced = new("numadvanced");
                 public int Numadvanced 
                 {
-                    get => Get<int>("numadvanced");
-                    set => Set<int>("numadvanced", value);
+                    get => Get<int>(_keyNumadvanced);
+                    set => Set<int>(_keyNumadvanced, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumbronze = new("numbronze");
                 public int Numbronze 
                 {
-                    get => Get<int>("numbronze");
-                    set => Set<int>("numbronze", value);
+                    get => Get<int>(_keyNumbronze);
+                    set => Set<int>(_keyNumbronze, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumsilver = new("numsilver");
                 public int Numsilver 
                 {
-                    get => Get<int>("numsilver");
-                    set => Set<int>("numsilver", value);
+                    get => Get<int>(_keyNumsilver);
+                    set => Set<int>(_keyNumsilver, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumgold = new("numgold");
                 public int Numgold 
                 {
-                    get => Get<int>("numgold");
-                    set => Set<int>("numgold", value);
+                    get => Get<int>(_keyNumgold);
+                    set => Set<int>(_keyNumgold, value);
                 }
             }
 
@@ -588,42 +637,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBotid = new("botid");
                 public CCSPlayerController Botid 
                 {
-                    get => Get<CCSPlayerController>("botid");
-                    set => Set<CCSPlayerController>("botid", value);
+                    get => Get<CCSPlayerController>(_keyBotid);
+                    set => Set<CCSPlayerController>(_keyBotid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyP = new("p");
                 public float P 
                 {
-                    get => Get<float>("p");
-                    set => Set<float>("p", value);
+                    get => Get<float>(_keyP);
+                    set => Set<float>(_keyP, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyR = new("r");
                 public float R 
                 {
-                    get => Get<float>("r");
-                    set => Set<float>("r", value);
+                    get => Get<float>(_keyR);
+                    set => Set<float>(_keyR, value);
                 }
             }
 
@@ -636,26 +690,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // BREAK_GLASS, BREAK_WOOD, etc
+                private static readonly GameEventKey _keyMaterial = new("material");
                 public int Material 
                 {
-                    get => Get<int>("material");
-                    set => Set<int>("material", value);
+                    get => Get<int>(_keyMaterial);
+                    set => Set<int>(_keyMaterial, value);
                 }
             }
 
@@ -668,18 +725,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -692,26 +751,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // BREAK_GLASS, BREAK_WOOD, etc
+                private static readonly GameEventKey _keyMaterial = new("material");
                 public int Material 
                 {
-                    get => Get<int>("material");
-                    set => Set<int>("material", value);
+                    get => Get<int>(_keyMaterial);
+                    set => Set<int>(_keyMaterial, value);
                 }
             }
 
@@ -724,82 +786,92 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosX = new("pos_x");
                 public int PosX 
                 {
-                    get => Get<int>("pos_x");
-                    set => Set<int>("pos_x", value);
+                    get => Get<int>(_keyPosX);
+                    set => Set<int>(_keyPosX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosY = new("pos_y");
                 public int PosY 
                 {
-                    get => Get<int>("pos_y");
-                    set => Set<int>("pos_y", value);
+                    get => Get<int>(_keyPosY);
+                    set => Set<int>(_keyPosY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosZ = new("pos_z");
                 public int PosZ 
                 {
-                    get => Get<int>("pos_z");
-                    set => Set<int>("pos_z", value);
+                    get => Get<int>(_keyPosZ);
+                    set => Set<int>(_keyPosZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngX = new("ang_x");
                 public int AngX 
                 {
-                    get => Get<int>("ang_x");
-                    set => Set<int>("ang_x", value);
+                    get => Get<int>(_keyAngX);
+                    set => Set<int>(_keyAngX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngY = new("ang_y");
                 public int AngY 
                 {
-                    get => Get<int>("ang_y");
-                    set => Set<int>("ang_y", value);
+                    get => Get<int>(_keyAngY);
+                    set => Set<int>(_keyAngY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAngZ = new("ang_z");
                 public int AngZ 
                 {
-                    get => Get<int>("ang_z");
-                    set => Set<int>("ang_z", value);
+                    get => Get<int>(_keyAngZ);
+                    set => Set<int>(_keyAngZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartX = new("start_x");
                 public int StartX 
                 {
-                    get => Get<int>("start_x");
-                    set => Set<int>("start_x", value);
+                    get => Get<int>(_keyStartX);
+                    set => Set<int>(_keyStartX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartY = new("start_y");
                 public int StartY 
                 {
-                    get => Get<int>("start_y");
-                    set => Set<int>("start_y", value);
+                    get => Get<int>(_keyStartY);
+                    set => Set<int>(_keyStartY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStartZ = new("start_z");
                 public int StartZ 
                 {
-                    get => Get<int>("start_z");
-                    set => Set<int>("start_z", value);
+                    get => Get<int>(_keyStartZ);
+                    set => Set<int>(_keyStartZ, value);
                 }
             }
 
@@ -812,34 +884,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -852,10 +928,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -895,10 +972,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyGlobal = new("global");
                 public bool Global 
                 {
-                    get => Get<bool>("global");
-                    set => Set<bool>("global", value);
+                    get => Get<bool>(_keyGlobal);
+                    set => Set<bool>(_keyGlobal, value);
                 }
             }
 
@@ -929,10 +1007,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyLessonName = new("lesson_name");
                 public string LessonName 
                 {
-                    get => Get<string>("lesson_name");
-                    set => Set<string>("lesson_name", value);
+                    get => Get<string>(_keyLessonName);
+                    set => Set<string>(_keyLessonName, value);
                 }
             }
 
@@ -981,10 +1060,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyNext = new("next");
                 public bool Next 
                 {
-                    get => Get<bool>("next");
-                    set => Set<bool>("next", value);
+                    get => Get<bool>(_keyNext);
+                    set => Set<bool>(_keyNext, value);
                 }
             }
 
@@ -1024,74 +1104,83 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyShowTimerDefend = new("show_timer_defend");
                 public bool ShowTimerDefend 
                 {
-                    get => Get<bool>("show_timer_defend");
-                    set => Set<bool>("show_timer_defend", value);
+                    get => Get<bool>(_keyShowTimerDefend);
+                    set => Set<bool>(_keyShowTimerDefend, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyShowTimerAttack = new("show_timer_attack");
                 public bool ShowTimerAttack 
                 {
-                    get => Get<bool>("show_timer_attack");
-                    set => Set<bool>("show_timer_attack", value);
+                    get => Get<bool>(_keyShowTimerAttack);
+                    set => Set<bool>(_keyShowTimerAttack, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTimerTime = new("timer_time");
                 public int TimerTime 
                 {
-                    get => Get<int>("timer_time");
-                    set => Set<int>("timer_time", value);
+                    get => Get<int>(_keyTimerTime);
+                    set => Set<int>(_keyTimerTime, value);
                 }
 
                 
                 // define in cs_gamerules.h
+                private static readonly GameEventKey _keyFinalEvent = new("final_event");
                 public int FinalEvent 
                 {
-                    get => Get<int>("final_event");
-                    set => Set<int>("final_event", value);
+                    get => Get<int>(_keyFinalEvent);
+                    set => Set<int>(_keyFinalEvent, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFunfactToken = new("funfact_token");
                 public string FunfactToken 
                 {
-                    get => Get<string>("funfact_token");
-                    set => Set<string>("funfact_token", value);
+                    get => Get<string>(_keyFunfactToken);
+                    set => Set<string>(_keyFunfactToken, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFunfactPlayer = new("funfact_player");
                 public CCSPlayerController FunfactPlayer 
                 {
-                    get => Get<CCSPlayerController>("funfact_player");
-                    set => Set<CCSPlayerController>("funfact_player", value);
+                    get => Get<CCSPlayerController>(_keyFunfactPlayer);
+                    set => Set<CCSPlayerController>(_keyFunfactPlayer, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFunfactData1 = new("funfact_data1");
                 public long FunfactData1 
                 {
-                    get => Get<long>("funfact_data1");
-                    set => Set<long>("funfact_data1", value);
+                    get => Get<long>(_keyFunfactData1);
+                    set => Set<long>(_keyFunfactData1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFunfactData2 = new("funfact_data2");
                 public long FunfactData2 
                 {
-                    get => Get<long>("funfact_data2");
-                    set => Set<long>("funfact_data2", value);
+                    get => Get<long>(_keyFunfactData2);
+                    set => Set<long>(_keyFunfactData2, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFunfactData3 = new("funfact_data3");
                 public long FunfactData3 
                 {
-                    get => Get<long>("funfact_data3");
-                    set => Set<long>("funfact_data3", value);
+                    get => Get<long>(_keyFunfactData3);
+                    set => Set<long>(_keyFunfactData3, value);
                 }
             }
 
@@ -1104,42 +1193,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -1152,42 +1246,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -1200,42 +1299,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -1248,10 +1352,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // defuser's entity ID
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public long Entityid 
                 {
-                    get => Get<long>("entityid");
-                    set => Set<long>("entityid", value);
+                    get => Get<long>(_keyEntityid);
+                    set => Set<long>(_keyEntityid, value);
                 }
             }
 
@@ -1264,18 +1369,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // defuser's entity ID
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public long Entityid 
                 {
-                    get => Get<long>("entityid");
-                    set => Set<long>("entityid", value);
+                    get => Get<long>(_keyEntityid);
+                    set => Set<long>(_keyEntityid, value);
                 }
 
                 
                 // player who picked up the defuser
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -1288,42 +1395,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyLocal = new("local");
                 public int Local 
                 {
-                    get => Get<int>("local");
-                    set => Set<int>("local", value);
+                    get => Get<int>(_keyLocal);
+                    set => Set<int>(_keyLocal, value);
                 }
 
                 
                 // current playback tick
+                private static readonly GameEventKey _keyPlaybackTick = new("playback_tick");
                 public long PlaybackTick 
                 {
-                    get => Get<long>("playback_tick");
-                    set => Set<long>("playback_tick", value);
+                    get => Get<long>(_keyPlaybackTick);
+                    set => Set<long>(_keyPlaybackTick, value);
                 }
 
                 
                 // tick we're going to
+                private static readonly GameEventKey _keySkiptoTick = new("skipto_tick");
                 public long SkiptoTick 
                 {
-                    get => Get<long>("skipto_tick");
-                    set => Set<long>("skipto_tick", value);
+                    get => Get<long>(_keySkiptoTick);
+                    set => Set<long>(_keySkiptoTick, value);
                 }
 
                 
                 // CSVCMsgList_UserMessages
+                private static readonly GameEventKey _keyUserMessageList = new("user_message_list");
                 public int UserMessageList 
                 {
-                    get => Get<int>("user_message_list");
-                    set => Set<int>("user_message_list", value);
+                    get => Get<int>(_keyUserMessageList);
+                    set => Set<int>(_keyUserMessageList, value);
                 }
 
                 
                 // CSVCMsgList_GameEvents
+                private static readonly GameEventKey _keyDotaHeroChaseList = new("dota_hero_chase_list");
                 public int DotaHeroChaseList 
                 {
-                    get => Get<int>("dota_hero_chase_list");
-                    set => Set<int>("dota_hero_chase_list", value);
+                    get => Get<int>(_keyDotaHeroChaseList);
+                    set => Set<int>(_keyDotaHeroChaseList, value);
                 }
             }
 
@@ -1336,34 +1448,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyLocal = new("local");
                 public int Local 
                 {
-                    get => Get<int>("local");
-                    set => Set<int>("local", value);
+                    get => Get<int>(_keyLocal);
+                    set => Set<int>(_keyLocal, value);
                 }
 
                 
                 // CSVCMsgList_GameEvents that are combat log events
+                private static readonly GameEventKey _keyDotaCombatlogList = new("dota_combatlog_list");
                 public int DotaCombatlogList 
                 {
-                    get => Get<int>("dota_combatlog_list");
-                    set => Set<int>("dota_combatlog_list", value);
+                    get => Get<int>(_keyDotaCombatlogList);
+                    set => Set<int>(_keyDotaCombatlogList, value);
                 }
 
                 
                 // CSVCMsgList_GameEvents
+                private static readonly GameEventKey _keyDotaHeroChaseList = new("dota_hero_chase_list");
                 public int DotaHeroChaseList 
                 {
-                    get => Get<int>("dota_hero_chase_list");
-                    set => Set<int>("dota_hero_chase_list", value);
+                    get => Get<int>(_keyDotaHeroChaseList);
+                    set => Set<int>(_keyDotaHeroChaseList, value);
                 }
 
                 
                 // CSVCMsgList_GameEvents
+                private static readonly GameEventKey _keyDotaPickHeroList = new("dota_pick_hero_list");
                 public int DotaPickHeroList 
                 {
-                    get => Get<int>("dota_pick_hero_list");
-                    set => Set<int>("dota_pick_hero_list", value);
+                    get => Get<int>(_keyDotaPickHeroList);
+                    set => Set<int>(_keyDotaPickHeroList, value);
                 }
             }
 
@@ -1385,26 +1501,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyNewdifficulty = new("newDifficulty");
                 public int Newdifficulty 
                 {
-                    get => Get<int>("newDifficulty");
-                    set => Set<int>("newDifficulty", value);
+                    get => Get<int>(_keyNewdifficulty);
+                    set => Set<int>(_keyNewdifficulty, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOlddifficulty = new("oldDifficulty");
                 public int Olddifficulty 
                 {
-                    get => Get<int>("oldDifficulty");
-                    set => Set<int>("oldDifficulty", value);
+                    get => Get<int>(_keyOlddifficulty);
+                    set => Set<int>(_keyOlddifficulty, value);
                 }
 
                 
                 // new difficulty as string
+                private static readonly GameEventKey _keyStrdifficulty = new("strDifficulty");
                 public string Strdifficulty 
                 {
-                    get => Get<string>("strDifficulty");
-                    set => Set<string>("strDifficulty", value);
+                    get => Get<string>(_keyStrdifficulty);
+                    set => Set<string>(_keyStrdifficulty, value);
                 }
             }
 
@@ -1417,18 +1536,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The length of time that this bonus lasts
+                private static readonly GameEventKey _keyTime = new("time");
                 public int Time 
                 {
-                    get => Get<int>("time");
-                    set => Set<int>("time", value);
+                    get => Get<int>(_keyTime);
+                    set => Set<int>(_keyTime, value);
                 }
 
                 
                 // Loadout position of the bonus weapon
+                private static readonly GameEventKey _keyPos = new("Pos");
                 public int Pos 
                 {
-                    get => Get<int>("Pos");
-                    set => Set<int>("Pos", value);
+                    get => Get<int>(_keyPos);
+                    set => Set<int>(_keyPos, value);
                 }
             }
 
@@ -1441,18 +1562,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDmgstate = new("dmgstate");
                 public long Dmgstate 
                 {
-                    get => Get<long>("dmgstate");
-                    set => Set<long>("dmgstate", value);
+                    get => Get<long>(_keyDmgstate);
+                    set => Set<long>(_keyDmgstate, value);
                 }
             }
 
@@ -1465,18 +1588,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Who closed the door
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // Is the door a checkpoint door
+                private static readonly GameEventKey _keyCheckpoint = new("checkpoint");
                 public bool Checkpoint 
                 {
-                    get => Get<bool>("checkpoint");
-                    set => Set<bool>("checkpoint", value);
+                    get => Get<bool>(_keyCheckpoint);
+                    set => Set<bool>(_keyCheckpoint, value);
                 }
             }
 
@@ -1489,18 +1614,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Who closed the door
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -1513,18 +1640,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -1537,18 +1666,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Who closed the door
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -1561,18 +1692,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCargo = new("cargo");
                 public int Cargo 
                 {
-                    get => Get<int>("cargo");
-                    set => Set<int>("cargo", value);
+                    get => Get<int>(_keyCargo);
+                    set => Set<int>(_keyCargo, value);
                 }
             }
 
@@ -1585,26 +1718,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCargo = new("cargo");
                 public int Cargo 
                 {
-                    get => Get<int>("cargo");
-                    set => Set<int>("cargo", value);
+                    get => Get<int>(_keyCargo);
+                    set => Set<int>(_keyCargo, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDelivered = new("delivered");
                 public bool Delivered 
                 {
-                    get => Get<bool>("delivered");
-                    set => Set<bool>("delivered", value);
+                    get => Get<bool>(_keyDelivered);
+                    set => Set<bool>(_keyDelivered, value);
                 }
             }
 
@@ -1617,26 +1753,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPriority = new("priority");
                 public int Priority 
                 {
-                    get => Get<int>("priority");
-                    set => Set<int>("priority", value);
+                    get => Get<int>(_keyPriority);
+                    set => Set<int>(_keyPriority, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDroneDispatchedParam = new("drone_dispatched");
                 public int DroneDispatchedParam 
                 {
-                    get => Get<int>("drone_dispatched");
-                    set => Set<int>("drone_dispatched", value);
+                    get => Get<int>(_keyDroneDispatchedParam);
+                    set => Set<int>(_keyDroneDispatchedParam, value);
                 }
             }
 
@@ -1649,10 +1788,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -1683,26 +1823,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player entindex
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // crate entindex
+                private static readonly GameEventKey _keySubject = new("subject");
                 public int Subject 
                 {
-                    get => Get<int>("subject");
-                    set => Set<int>("subject", value);
+                    get => Get<int>(_keySubject);
+                    set => Set<int>(_keySubject, value);
                 }
 
                 
                 // type of crate (metal, wood, or paradrop)
+                private static readonly GameEventKey _keyType = new("type");
                 public string Type 
                 {
-                    get => Get<string>("type");
-                    set => Set<string>("type", value);
+                    get => Get<string>(_keyType);
+                    set => Set<string>(_keyType, value);
                 }
             }
 
@@ -1715,10 +1858,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEnable = new("enable");
                 public bool Enable 
                 {
-                    get => Get<bool>("enable");
-                    set => Set<bool>("enable", value);
+                    get => Get<bool>(_keyEnable);
+                    set => Set<bool>(_keyEnable, value);
                 }
             }
 
@@ -1740,90 +1884,101 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Number of "ties"
+                private static readonly GameEventKey _keyCount = new("count");
                 public int Count 
                 {
-                    get => Get<int>("count");
-                    set => Set<int>("count", value);
+                    get => Get<int>(_keyCount);
+                    set => Set<int>(_keyCount, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot1 = new("slot1");
                 public int Slot1 
                 {
-                    get => Get<int>("slot1");
-                    set => Set<int>("slot1", value);
+                    get => Get<int>(_keySlot1);
+                    set => Set<int>(_keySlot1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot2 = new("slot2");
                 public int Slot2 
                 {
-                    get => Get<int>("slot2");
-                    set => Set<int>("slot2", value);
+                    get => Get<int>(_keySlot2);
+                    set => Set<int>(_keySlot2, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot3 = new("slot3");
                 public int Slot3 
                 {
-                    get => Get<int>("slot3");
-                    set => Set<int>("slot3", value);
+                    get => Get<int>(_keySlot3);
+                    set => Set<int>(_keySlot3, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot4 = new("slot4");
                 public int Slot4 
                 {
-                    get => Get<int>("slot4");
-                    set => Set<int>("slot4", value);
+                    get => Get<int>(_keySlot4);
+                    set => Set<int>(_keySlot4, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot5 = new("slot5");
                 public int Slot5 
                 {
-                    get => Get<int>("slot5");
-                    set => Set<int>("slot5", value);
+                    get => Get<int>(_keySlot5);
+                    set => Set<int>(_keySlot5, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot6 = new("slot6");
                 public int Slot6 
                 {
-                    get => Get<int>("slot6");
-                    set => Set<int>("slot6", value);
+                    get => Get<int>(_keySlot6);
+                    set => Set<int>(_keySlot6, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot7 = new("slot7");
                 public int Slot7 
                 {
-                    get => Get<int>("slot7");
-                    set => Set<int>("slot7", value);
+                    get => Get<int>(_keySlot7);
+                    set => Set<int>(_keySlot7, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot8 = new("slot8");
                 public int Slot8 
                 {
-                    get => Get<int>("slot8");
-                    set => Set<int>("slot8", value);
+                    get => Get<int>(_keySlot8);
+                    set => Set<int>(_keySlot8, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot9 = new("slot9");
                 public int Slot9 
                 {
-                    get => Get<int>("slot9");
-                    set => Set<int>("slot9", value);
+                    get => Get<int>(_keySlot9);
+                    set => Set<int>(_keySlot9, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot10 = new("slot10");
                 public int Slot10 
                 {
-                    get => Get<int>("slot10");
-                    set => Set<int>("slot10", value);
+                    get => Get<int>(_keySlot10);
+                    set => Set<int>(_keySlot10, value);
                 }
             }
 
@@ -1836,26 +1991,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHasbomb = new("hasbomb");
                 public bool Hasbomb 
                 {
-                    get => Get<bool>("hasbomb");
-                    set => Set<bool>("hasbomb", value);
+                    get => Get<bool>(_keyHasbomb);
+                    set => Set<bool>(_keyHasbomb, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyIsplanted = new("isplanted");
                 public bool Isplanted 
                 {
-                    get => Get<bool>("isplanted");
-                    set => Set<bool>("isplanted", value);
+                    get => Get<bool>(_keyIsplanted);
+                    set => Set<bool>(_keyIsplanted, value);
                 }
             }
 
@@ -1868,18 +2026,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCanbuy = new("canbuy");
                 public bool Canbuy 
                 {
-                    get => Get<bool>("canbuy");
-                    set => Set<bool>("canbuy", value);
+                    get => Get<bool>(_keyCanbuy);
+                    set => Set<bool>(_keyCanbuy, value);
                 }
             }
 
@@ -1892,10 +2052,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -1908,34 +2069,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindexKilled = new("entindex_killed");
                 public long EntindexKilled 
                 {
-                    get => Get<long>("entindex_killed");
-                    set => Set<long>("entindex_killed", value);
+                    get => Get<long>(_keyEntindexKilled);
+                    set => Set<long>(_keyEntindexKilled, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindexAttacker = new("entindex_attacker");
                 public long EntindexAttacker 
                 {
-                    get => Get<long>("entindex_attacker");
-                    set => Set<long>("entindex_attacker", value);
+                    get => Get<long>(_keyEntindexAttacker);
+                    set => Set<long>(_keyEntindexAttacker, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntindexInflictor = new("entindex_inflictor");
                 public long EntindexInflictor 
                 {
-                    get => Get<long>("entindex_inflictor");
-                    set => Set<long>("entindex_inflictor", value);
+                    get => Get<long>(_keyEntindexInflictor);
+                    set => Set<long>(_keyEntindexInflictor, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDamagebits = new("damagebits");
                 public long Damagebits 
                 {
-                    get => Get<long>("damagebits");
-                    set => Set<long>("damagebits", value);
+                    get => Get<long>(_keyDamagebits);
+                    set => Set<long>(_keyDamagebits, value);
                 }
             }
 
@@ -1948,34 +2113,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The player who sees the entity
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // Entindex of the entity they see
+                private static readonly GameEventKey _keySubject = new("subject");
                 public int Subject 
                 {
-                    get => Get<int>("subject");
-                    set => Set<int>("subject", value);
+                    get => Get<int>(_keySubject);
+                    set => Set<int>(_keySubject, value);
                 }
 
                 
                 // Classname of the entity they see
+                private static readonly GameEventKey _keyClassname = new("classname");
                 public string Classname 
                 {
-                    get => Get<string>("classname");
-                    set => Set<string>("classname", value);
+                    get => Get<string>(_keyClassname);
+                    set => Set<string>(_keyClassname, value);
                 }
 
                 
                 // name of the entity they see
+                private static readonly GameEventKey _keyEntityname = new("entityname");
                 public string Entityname 
                 {
-                    get => Get<string>("entityname");
-                    set => Set<string>("entityname", value);
+                    get => Get<string>(_keyEntityname);
+                    set => Set<string>(_keyEntityname, value);
                 }
             }
 
@@ -1997,26 +2166,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHasbomb = new("hasbomb");
                 public bool Hasbomb 
                 {
-                    get => Get<bool>("hasbomb");
-                    set => Set<bool>("hasbomb", value);
+                    get => Get<bool>(_keyHasbomb);
+                    set => Set<bool>(_keyHasbomb, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyIsplanted = new("isplanted");
                 public bool Isplanted 
                 {
-                    get => Get<bool>("isplanted");
-                    set => Set<bool>("isplanted", value);
+                    get => Get<bool>(_keyIsplanted);
+                    set => Set<bool>(_keyIsplanted, value);
                 }
             }
 
@@ -2029,18 +2201,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCanbuy = new("canbuy");
                 public bool Canbuy 
                 {
-                    get => Get<bool>("canbuy");
-                    set => Set<bool>("canbuy", value);
+                    get => Get<bool>(_keyCanbuy);
+                    set => Set<bool>(_keyCanbuy, value);
                 }
             }
 
@@ -2053,10 +2227,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -2069,10 +2244,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyRushes = new("rushes");
                 public int Rushes 
                 {
-                    get => Get<int>("rushes");
-                    set => Set<int>("rushes", value);
+                    get => Get<int>(_keyRushes);
+                    set => Set<int>(_keyRushes, value);
                 }
             }
 
@@ -2085,10 +2261,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyGlobal = new("global");
                 public bool Global 
                 {
-                    get => Get<bool>("global");
-                    set => Set<bool>("global", value);
+                    get => Get<bool>(_keyGlobal);
+                    set => Set<bool>(_keyGlobal, value);
                 }
             }
 
@@ -2101,10 +2278,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // entity ignited
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -2117,42 +2295,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -2165,10 +2348,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // winner team/user id
+                private static readonly GameEventKey _keyWinner = new("winner");
                 public int Winner 
                 {
-                    get => Get<int>("winner");
-                    set => Set<int>("winner", value);
+                    get => Get<int>(_keyWinner);
+                    set => Set<int>(_keyWinner, value);
                 }
             }
 
@@ -2208,18 +2392,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // 0 = console, 1 = HUD
+                private static readonly GameEventKey _keyTarget = new("target");
                 public int Target 
                 {
-                    get => Get<int>("target");
-                    set => Set<int>("target", value);
+                    get => Get<int>(_keyTarget);
+                    set => Set<int>(_keyTarget, value);
                 }
 
                 
                 // the message text
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
             }
 
@@ -2232,10 +2418,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // map name
+                private static readonly GameEventKey _keyMapname = new("mapname");
                 public string Mapname 
                 {
-                    get => Get<string>("mapname");
-                    set => Set<string>("mapname", value);
+                    get => Get<string>(_keyMapname);
+                    set => Set<string>(_keyMapname, value);
                 }
             }
 
@@ -2248,10 +2435,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyNewPhase = new("new_phase");
                 public int NewPhase 
                 {
-                    get => Get<int>("new_phase");
-                    set => Set<int>("new_phase", value);
+                    get => Get<int>(_keyNewPhase);
+                    set => Set<int>(_keyNewPhase, value);
                 }
             }
 
@@ -2264,34 +2452,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // max round
+                private static readonly GameEventKey _keyRoundslimit = new("roundslimit");
                 public long Roundslimit 
                 {
-                    get => Get<long>("roundslimit");
-                    set => Set<long>("roundslimit", value);
+                    get => Get<long>(_keyRoundslimit);
+                    set => Set<long>(_keyRoundslimit, value);
                 }
 
                 
                 // time limit
+                private static readonly GameEventKey _keyTimelimit = new("timelimit");
                 public long Timelimit 
                 {
-                    get => Get<long>("timelimit");
-                    set => Set<long>("timelimit", value);
+                    get => Get<long>(_keyTimelimit);
+                    set => Set<long>(_keyTimelimit, value);
                 }
 
                 
                 // frag limit
+                private static readonly GameEventKey _keyFraglimit = new("fraglimit");
                 public long Fraglimit 
                 {
-                    get => Get<long>("fraglimit");
-                    set => Set<long>("fraglimit", value);
+                    get => Get<long>(_keyFraglimit);
+                    set => Set<long>(_keyFraglimit, value);
                 }
 
                 
                 // round objective
+                private static readonly GameEventKey _keyObjective = new("objective");
                 public string Objective 
                 {
-                    get => Get<string>("objective");
-                    set => Set<string>("objective", value);
+                    get => Get<string>(_keyObjective);
+                    set => Set<string>(_keyObjective, value);
                 }
             }
 
@@ -2322,42 +2514,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID who died
+                private static readonly GameEventKey _keyVictimid = new("victimid");
                 public CCSPlayerController Victimid 
                 {
-                    get => Get<CCSPlayerController>("victimid");
-                    set => Set<CCSPlayerController>("victimid", value);
+                    get => Get<CCSPlayerController>(_keyVictimid);
+                    set => Set<CCSPlayerController>(_keyVictimid, value);
                 }
 
                 
                 // user ID who killed
+                private static readonly GameEventKey _keyAttackerid = new("attackerid");
                 public CCSPlayerController Attackerid 
                 {
-                    get => Get<CCSPlayerController>("attackerid");
-                    set => Set<CCSPlayerController>("attackerid", value);
+                    get => Get<CCSPlayerController>(_keyAttackerid);
+                    set => Set<CCSPlayerController>(_keyAttackerid, value);
                 }
 
                 
                 // did killer dominate victim with this kill
+                private static readonly GameEventKey _keyDominated = new("dominated");
                 public int Dominated 
                 {
-                    get => Get<int>("dominated");
-                    set => Set<int>("dominated", value);
+                    get => Get<int>(_keyDominated);
+                    set => Set<int>(_keyDominated, value);
                 }
 
                 
                 // did killer get revenge on victim with this kill
+                private static readonly GameEventKey _keyRevenge = new("revenge");
                 public int Revenge 
                 {
-                    get => Get<int>("revenge");
-                    set => Set<int>("revenge", value);
+                    get => Get<int>(_keyRevenge);
+                    set => Set<int>(_keyRevenge, value);
                 }
 
                 
                 // did killer kill with a bonus weapon?
+                private static readonly GameEventKey _keyBonus = new("bonus");
                 public bool Bonus 
                 {
-                    get => Get<bool>("bonus");
-                    set => Set<bool>("bonus", value);
+                    get => Get<bool>(_keyBonus);
+                    set => Set<bool>(_keyBonus, value);
                 }
             }
 
@@ -2370,10 +2567,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -2386,18 +2584,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // weapon name used
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
             }
 
@@ -2419,42 +2619,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -2485,10 +2690,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // camera man entity index
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -2501,26 +2707,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyOldmode = new("oldmode");
                 public long Oldmode 
                 {
-                    get => Get<long>("oldmode");
-                    set => Set<long>("oldmode", value);
+                    get => Get<long>(_keyOldmode);
+                    set => Set<long>(_keyOldmode, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNewmode = new("newmode");
                 public long Newmode 
                 {
-                    get => Get<long>("newmode");
-                    set => Set<long>("newmode", value);
+                    get => Get<long>(_keyNewmode);
+                    set => Set<long>(_keyNewmode, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyObsTarget = new("obs_target");
                 public long ObsTarget 
                 {
-                    get => Get<long>("obs_target");
-                    set => Set<long>("obs_target", value);
+                    get => Get<long>(_keyObsTarget);
+                    set => Set<long>(_keyObsTarget, value);
                 }
             }
 
@@ -2533,58 +2742,65 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // primary traget index
+                private static readonly GameEventKey _keyTarget1 = new("target1");
                 public CCSPlayerController Target1 
                 {
-                    get => Get<CCSPlayerController>("target1");
-                    set => Set<CCSPlayerController>("target1", value);
+                    get => Get<CCSPlayerController>(_keyTarget1);
+                    set => Set<CCSPlayerController>(_keyTarget1, value);
                 }
 
                 
                 // secondary traget index or 0
+                private static readonly GameEventKey _keyTarget2 = new("target2");
                 public CCSPlayerController Target2 
                 {
-                    get => Get<CCSPlayerController>("target2");
-                    set => Set<CCSPlayerController>("target2", value);
+                    get => Get<CCSPlayerController>(_keyTarget2);
+                    set => Set<CCSPlayerController>(_keyTarget2, value);
                 }
 
                 
                 // camera distance
+                private static readonly GameEventKey _keyDistance = new("distance");
                 public int Distance 
                 {
-                    get => Get<int>("distance");
-                    set => Set<int>("distance", value);
+                    get => Get<int>(_keyDistance);
+                    set => Set<int>(_keyDistance, value);
                 }
 
                 
                 // view angle horizontal
+                private static readonly GameEventKey _keyTheta = new("theta");
                 public int Theta 
                 {
-                    get => Get<int>("theta");
-                    set => Set<int>("theta", value);
+                    get => Get<int>(_keyTheta);
+                    set => Set<int>(_keyTheta, value);
                 }
 
                 
                 // view angle vertical
+                private static readonly GameEventKey _keyPhi = new("phi");
                 public int Phi 
                 {
-                    get => Get<int>("phi");
-                    set => Set<int>("phi", value);
+                    get => Get<int>(_keyPhi);
+                    set => Set<int>(_keyPhi, value);
                 }
 
                 
                 // camera inertia
+                private static readonly GameEventKey _keyInertia = new("inertia");
                 public int Inertia 
                 {
-                    get => Get<int>("inertia");
-                    set => Set<int>("inertia", value);
+                    get => Get<int>(_keyInertia);
+                    set => Set<int>(_keyInertia, value);
                 }
 
                 
                 // diretcor suggests to show ineye
+                private static readonly GameEventKey _keyIneye = new("ineye");
                 public int Ineye 
                 {
-                    get => Get<int>("ineye");
-                    set => Set<int>("ineye", value);
+                    get => Get<int>(_keyIneye);
+                    set => Set<int>(_keyIneye, value);
                 }
             }
 
@@ -2597,18 +2813,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
 
                 
                 // steam id
+                private static readonly GameEventKey _keySteamid = new("steamID");
                 public ulong Steamid 
                 {
-                    get => Get<ulong>("steamID");
-                    set => Set<ulong>("steamID", value);
+                    get => Get<ulong>(_keySteamid);
+                    set => Set<ulong>(_keySteamid, value);
                 }
             }
 
@@ -2621,66 +2839,74 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // camera position in world
+                private static readonly GameEventKey _keyPosx = new("posx");
                 public long Posx 
                 {
-                    get => Get<long>("posx");
-                    set => Set<long>("posx", value);
+                    get => Get<long>(_keyPosx);
+                    set => Set<long>(_keyPosx, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosy = new("posy");
                 public long Posy 
                 {
-                    get => Get<long>("posy");
-                    set => Set<long>("posy", value);
+                    get => Get<long>(_keyPosy);
+                    set => Set<long>(_keyPosy, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPosz = new("posz");
                 public long Posz 
                 {
-                    get => Get<long>("posz");
-                    set => Set<long>("posz", value);
+                    get => Get<long>(_keyPosz);
+                    set => Set<long>(_keyPosz, value);
                 }
 
                 
                 // camera angles
+                private static readonly GameEventKey _keyTheta = new("theta");
                 public int Theta 
                 {
-                    get => Get<int>("theta");
-                    set => Set<int>("theta", value);
+                    get => Get<int>(_keyTheta);
+                    set => Set<int>(_keyTheta, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPhi = new("phi");
                 public int Phi 
                 {
-                    get => Get<int>("phi");
-                    set => Set<int>("phi", value);
+                    get => Get<int>(_keyPhi);
+                    set => Set<int>(_keyPhi, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOffset = new("offset");
                 public int Offset 
                 {
-                    get => Get<int>("offset");
-                    set => Set<int>("offset", value);
+                    get => Get<int>(_keyOffset);
+                    set => Set<int>(_keyOffset, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyFov = new("fov");
                 public float Fov 
                 {
-                    get => Get<float>("fov");
-                    set => Set<float>("fov", value);
+                    get => Get<float>(_keyFov);
+                    set => Set<float>(_keyFov, value);
                 }
 
                 
                 // follow this player
+                private static readonly GameEventKey _keyTarget = new("target");
                 public CCSPlayerController Target 
                 {
-                    get => Get<CCSPlayerController>("target");
-                    set => Set<CCSPlayerController>("target", value);
+                    get => Get<CCSPlayerController>(_keyTarget);
+                    set => Set<CCSPlayerController>(_keyTarget, value);
                 }
             }
 
@@ -2693,10 +2919,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
             }
 
@@ -2709,26 +2936,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // fixed camera index
+                private static readonly GameEventKey _keyIndex = new("index");
                 public int Index 
                 {
-                    get => Get<int>("index");
-                    set => Set<int>("index", value);
+                    get => Get<int>(_keyIndex);
+                    set => Set<int>(_keyIndex, value);
                 }
 
                 
                 // ranking, how interesting is this camera view
+                private static readonly GameEventKey _keyRank = new("rank");
                 public float Rank 
                 {
-                    get => Get<float>("rank");
-                    set => Set<float>("rank", value);
+                    get => Get<float>(_keyRank);
+                    set => Set<float>(_keyRank, value);
                 }
 
                 
                 // best/closest target entity
+                private static readonly GameEventKey _keyTarget = new("target");
                 public CCSPlayerController Target 
                 {
-                    get => Get<CCSPlayerController>("target");
-                    set => Set<CCSPlayerController>("target", value);
+                    get => Get<CCSPlayerController>(_keyTarget);
+                    set => Set<CCSPlayerController>(_keyTarget, value);
                 }
             }
 
@@ -2741,26 +2971,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player slot
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // ranking, how interesting is this entity to view
+                private static readonly GameEventKey _keyRank = new("rank");
                 public float Rank 
                 {
-                    get => Get<float>("rank");
-                    set => Set<float>("rank", value);
+                    get => Get<float>(_keyRank);
+                    set => Set<float>(_keyRank, value);
                 }
 
                 
                 // best/closest target entity
+                private static readonly GameEventKey _keyTarget = new("target");
                 public CCSPlayerController Target 
                 {
-                    get => Get<CCSPlayerController>("target");
-                    set => Set<CCSPlayerController>("target", value);
+                    get => Get<CCSPlayerController>(_keyTarget);
+                    set => Set<CCSPlayerController>(_keyTarget, value);
                 }
             }
 
@@ -2773,18 +3006,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // number of seconds in killer replay delay
+                private static readonly GameEventKey _keyDelay = new("delay");
                 public long Delay 
                 {
-                    get => Get<long>("delay");
-                    set => Set<long>("delay", value);
+                    get => Get<long>(_keyDelay);
+                    set => Set<long>(_keyDelay, value);
                 }
 
                 
                 // reason for replay	(ReplayEventType_t)
+                private static readonly GameEventKey _keyReason = new("reason");
                 public long Reason 
                 {
-                    get => Get<long>("reason");
-                    set => Set<long>("reason", value);
+                    get => Get<long>(_keyReason);
+                    set => Set<long>(_keyReason, value);
                 }
             }
 
@@ -2797,10 +3032,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // reason for hltv replay status change ()
+                private static readonly GameEventKey _keyReason = new("reason");
                 public long Reason 
                 {
-                    get => Get<long>("reason");
-                    set => Set<long>("reason", value);
+                    get => Get<long>(_keyReason);
+                    set => Set<long>(_keyReason, value);
                 }
             }
 
@@ -2813,34 +3049,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // number of HLTV spectators
+                private static readonly GameEventKey _keyClients = new("clients");
                 public long Clients 
                 {
-                    get => Get<long>("clients");
-                    set => Set<long>("clients", value);
+                    get => Get<long>(_keyClients);
+                    set => Set<long>(_keyClients, value);
                 }
 
                 
                 // number of HLTV slots
+                private static readonly GameEventKey _keySlots = new("slots");
                 public long Slots 
                 {
-                    get => Get<long>("slots");
-                    set => Set<long>("slots", value);
+                    get => Get<long>(_keySlots);
+                    set => Set<long>(_keySlots, value);
                 }
 
                 
                 // number of HLTV proxies
+                private static readonly GameEventKey _keyProxies = new("proxies");
                 public int Proxies 
                 {
-                    get => Get<int>("proxies");
-                    set => Set<int>("proxies", value);
+                    get => Get<int>(_keyProxies);
+                    set => Set<int>(_keyProxies, value);
                 }
 
                 
                 // disptach master IP:port
+                private static readonly GameEventKey _keyMaster = new("master");
                 public string Master 
                 {
-                    get => Get<string>("master");
-                    set => Set<string>("master", value);
+                    get => Get<string>(_keyMaster);
+                    set => Set<string>(_keyMaster, value);
                 }
             }
 
@@ -2853,10 +3093,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
             }
 
@@ -2869,10 +3110,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyVersion = new("version");
                 public long Version 
                 {
-                    get => Get<long>("version");
-                    set => Set<long>("version", value);
+                    get => Get<long>(_keyVersion);
+                    set => Set<long>(_keyVersion, value);
                 }
             }
 
@@ -2885,10 +3127,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
             }
 
@@ -2901,18 +3144,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who touched the hostage
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
             }
 
@@ -2925,18 +3170,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who hurt the hostage
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
             }
 
@@ -2949,18 +3196,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who killed the hostage
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
             }
 
@@ -2973,26 +3222,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who rescued the hostage
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
 
                 
                 // rescue site index
+                private static readonly GameEventKey _keySite = new("site");
                 public int Site 
                 {
-                    get => Get<int>("site");
-                    set => Set<int>("site", value);
+                    get => Get<int>(_keySite);
+                    set => Set<int>(_keySite, value);
                 }
             }
 
@@ -3014,18 +3266,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who rescued the hostage
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // hostage entity index
+                private static readonly GameEventKey _keyHostage = new("hostage");
                 public int Hostage 
                 {
-                    get => Get<int>("hostage");
-                    set => Set<int>("hostage", value);
+                    get => Get<int>(_keyHostage);
+                    set => Set<int>(_keyHostage, value);
                 }
             }
 
@@ -3038,10 +3292,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyHostname = new("hostname");
                 public string Hostname 
                 {
-                    get => Get<string>("hostname");
-                    set => Set<string>("hostname", value);
+                    get => Get<string>(_keyHostname);
+                    set => Set<string>(_keyHostname, value);
                 }
             }
 
@@ -3054,34 +3309,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -3094,34 +3353,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -3134,34 +3397,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -3174,10 +3441,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -3190,18 +3458,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The player who this lesson is intended for
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // Name of the lesson to start.  Must match instructor_lesson.txt
+                private static readonly GameEventKey _keyHintName = new("hint_name");
                 public string HintName 
                 {
-                    get => Get<string>("hint_name");
-                    set => Set<string>("hint_name", value);
+                    get => Get<string>(_keyHintName);
+                    set => Set<string>(_keyHintName, value);
                 }
             }
 
@@ -3214,162 +3484,182 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID of the player that triggered the hint
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // what to name the hint. For referencing it again later (e.g. a kill command for the hint instead of a timeout)
+                private static readonly GameEventKey _keyHintName = new("hint_name");
                 public string HintName 
                 {
-                    get => Get<string>("hint_name");
-                    set => Set<string>("hint_name", value);
+                    get => Get<string>(_keyHintName);
+                    set => Set<string>(_keyHintName, value);
                 }
 
                 
                 // type name so that messages of the same type will replace each other
+                private static readonly GameEventKey _keyHintReplaceKey = new("hint_replace_key");
                 public string HintReplaceKey 
                 {
-                    get => Get<string>("hint_replace_key");
-                    set => Set<string>("hint_replace_key", value);
+                    get => Get<string>(_keyHintReplaceKey);
+                    set => Set<string>(_keyHintReplaceKey, value);
                 }
 
                 
                 // entity id that the hint should display at
+                private static readonly GameEventKey _keyHintTarget = new("hint_target");
                 public long HintTarget 
                 {
-                    get => Get<long>("hint_target");
-                    set => Set<long>("hint_target", value);
+                    get => Get<long>(_keyHintTarget);
+                    set => Set<long>(_keyHintTarget, value);
                 }
 
                 
                 // userid id of the activator
+                private static readonly GameEventKey _keyHintActivatorUserid = new("hint_activator_userid");
                 public CCSPlayerController HintActivatorUserid 
                 {
-                    get => Get<CCSPlayerController>("hint_activator_userid");
-                    set => Set<CCSPlayerController>("hint_activator_userid", value);
+                    get => Get<CCSPlayerController>(_keyHintActivatorUserid);
+                    set => Set<CCSPlayerController>(_keyHintActivatorUserid, value);
                 }
 
                 
                 // how long in seconds until the hint automatically times out, 0 = never
+                private static readonly GameEventKey _keyHintTimeout = new("hint_timeout");
                 public int HintTimeout 
                 {
-                    get => Get<int>("hint_timeout");
-                    set => Set<int>("hint_timeout", value);
+                    get => Get<int>(_keyHintTimeout);
+                    set => Set<int>(_keyHintTimeout, value);
                 }
 
                 
                 // the hint icon to use when the hint is onscreen. e.g. "icon_alert_red"
+                private static readonly GameEventKey _keyHintIconOnscreen = new("hint_icon_onscreen");
                 public string HintIconOnscreen 
                 {
-                    get => Get<string>("hint_icon_onscreen");
-                    set => Set<string>("hint_icon_onscreen", value);
+                    get => Get<string>(_keyHintIconOnscreen);
+                    set => Set<string>(_keyHintIconOnscreen, value);
                 }
 
                 
                 // the hint icon to use when the hint is offscreen. e.g. "icon_alert"
+                private static readonly GameEventKey _keyHintIconOffscreen = new("hint_icon_offscreen");
                 public string HintIconOffscreen 
                 {
-                    get => Get<string>("hint_icon_offscreen");
-                    set => Set<string>("hint_icon_offscreen", value);
+                    get => Get<string>(_keyHintIconOffscreen);
+                    set => Set<string>(_keyHintIconOffscreen, value);
                 }
 
                 
                 // the hint caption. e.g. "#ThisIsDangerous"
+                private static readonly GameEventKey _keyHintCaption = new("hint_caption");
                 public string HintCaption 
                 {
-                    get => Get<string>("hint_caption");
-                    set => Set<string>("hint_caption", value);
+                    get => Get<string>(_keyHintCaption);
+                    set => Set<string>(_keyHintCaption, value);
                 }
 
                 
                 // the hint caption that only the activator sees e.g. "#YouPushedItGood"
+                private static readonly GameEventKey _keyHintActivatorCaption = new("hint_activator_caption");
                 public string HintActivatorCaption 
                 {
-                    get => Get<string>("hint_activator_caption");
-                    set => Set<string>("hint_activator_caption", value);
+                    get => Get<string>(_keyHintActivatorCaption);
+                    set => Set<string>(_keyHintActivatorCaption, value);
                 }
 
                 
                 // the hint color in "r,g,b" format where each component is 0-255
+                private static readonly GameEventKey _keyHintColor = new("hint_color");
                 public string HintColor 
                 {
-                    get => Get<string>("hint_color");
-                    set => Set<string>("hint_color", value);
+                    get => Get<string>(_keyHintColor);
+                    set => Set<string>(_keyHintColor, value);
                 }
 
                 
                 // how far on the z axis to offset the hint from entity origin
+                private static readonly GameEventKey _keyHintIconOffset = new("hint_icon_offset");
                 public float HintIconOffset 
                 {
-                    get => Get<float>("hint_icon_offset");
-                    set => Set<float>("hint_icon_offset", value);
+                    get => Get<float>(_keyHintIconOffset);
+                    set => Set<float>(_keyHintIconOffset, value);
                 }
 
                 
                 // range before the hint is culled
+                private static readonly GameEventKey _keyHintRange = new("hint_range");
                 public float HintRange 
                 {
-                    get => Get<float>("hint_range");
-                    set => Set<float>("hint_range", value);
+                    get => Get<float>(_keyHintRange);
+                    set => Set<float>(_keyHintRange, value);
                 }
 
                 
                 // hint flags
+                private static readonly GameEventKey _keyHintFlags = new("hint_flags");
                 public long HintFlags 
                 {
-                    get => Get<long>("hint_flags");
-                    set => Set<long>("hint_flags", value);
+                    get => Get<long>(_keyHintFlags);
+                    set => Set<long>(_keyHintFlags, value);
                 }
 
                 
                 // bindings to use when use_binding is the onscreen icon
+                private static readonly GameEventKey _keyHintBinding = new("hint_binding");
                 public string HintBinding 
                 {
-                    get => Get<string>("hint_binding");
-                    set => Set<string>("hint_binding", value);
+                    get => Get<string>(_keyHintBinding);
+                    set => Set<string>(_keyHintBinding, value);
                 }
 
                 
                 // gamepad bindings to use when use_binding is the onscreen icon
+                private static readonly GameEventKey _keyHintGamepadBinding = new("hint_gamepad_binding");
                 public string HintGamepadBinding 
                 {
-                    get => Get<string>("hint_gamepad_binding");
-                    set => Set<string>("hint_gamepad_binding", value);
+                    get => Get<string>(_keyHintGamepadBinding);
+                    set => Set<string>(_keyHintGamepadBinding, value);
                 }
 
                 
                 // if false, the hint will dissappear if the target entity is invisible
+                private static readonly GameEventKey _keyHintAllowNodrawTarget = new("hint_allow_nodraw_target");
                 public bool HintAllowNodrawTarget 
                 {
-                    get => Get<bool>("hint_allow_nodraw_target");
-                    set => Set<bool>("hint_allow_nodraw_target", value);
+                    get => Get<bool>(_keyHintAllowNodrawTarget);
+                    set => Set<bool>(_keyHintAllowNodrawTarget, value);
                 }
 
                 
                 // if true, the hint will not show when outside the player view
+                private static readonly GameEventKey _keyHintNooffscreen = new("hint_nooffscreen");
                 public bool HintNooffscreen 
                 {
-                    get => Get<bool>("hint_nooffscreen");
-                    set => Set<bool>("hint_nooffscreen", value);
+                    get => Get<bool>(_keyHintNooffscreen);
+                    set => Set<bool>(_keyHintNooffscreen, value);
                 }
 
                 
                 // if true, the hint caption will show even if the hint is occluded
+                private static readonly GameEventKey _keyHintForcecaption = new("hint_forcecaption");
                 public bool HintForcecaption 
                 {
-                    get => Get<bool>("hint_forcecaption");
-                    set => Set<bool>("hint_forcecaption", value);
+                    get => Get<bool>(_keyHintForcecaption);
+                    set => Set<bool>(_keyHintForcecaption, value);
                 }
 
                 
                 // if true, only the local player will see the hint
+                private static readonly GameEventKey _keyHintLocalPlayerOnly = new("hint_local_player_only");
                 public bool HintLocalPlayerOnly 
                 {
-                    get => Get<bool>("hint_local_player_only");
-                    set => Set<bool>("hint_local_player_only", value);
+                    get => Get<bool>(_keyHintLocalPlayerOnly);
+                    set => Set<bool>(_keyHintLocalPlayerOnly, value);
                 }
             }
 
@@ -3382,10 +3672,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The hint to stop. Will stop ALL hints with this name
+                private static readonly GameEventKey _keyHintName = new("hint_name");
                 public string HintName 
                 {
-                    get => Get<string>("hint_name");
-                    set => Set<string>("hint_name", value);
+                    get => Get<string>(_keyHintName);
+                    set => Set<string>(_keyHintName, value);
                 }
             }
 
@@ -3398,50 +3689,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The player who this lesson is intended for
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // Name of the lesson to start.  Must match instructor_lesson.txt
+                private static readonly GameEventKey _keyHintName = new("hint_name");
                 public string HintName 
                 {
-                    get => Get<string>("hint_name");
-                    set => Set<string>("hint_name", value);
+                    get => Get<string>(_keyHintName);
+                    set => Set<string>(_keyHintName, value);
                 }
 
                 
                 // entity id that the hint should display at. Leave empty if controller target
+                private static readonly GameEventKey _keyHintTarget = new("hint_target");
                 public long HintTarget 
                 {
-                    get => Get<long>("hint_target");
-                    set => Set<long>("hint_target", value);
+                    get => Get<long>(_keyHintTarget);
+                    set => Set<long>(_keyHintTarget, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVrMovementType = new("vr_movement_type");
                 public int VrMovementType 
                 {
-                    get => Get<int>("vr_movement_type");
-                    set => Set<int>("vr_movement_type", value);
+                    get => Get<int>(_keyVrMovementType);
+                    set => Set<int>(_keyVrMovementType, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVrSingleController = new("vr_single_controller");
                 public bool VrSingleController 
                 {
-                    get => Get<bool>("vr_single_controller");
-                    set => Set<bool>("vr_single_controller", value);
+                    get => Get<bool>(_keyVrSingleController);
+                    set => Set<bool>(_keyVrSingleController, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVrControllerType = new("vr_controller_type");
                 public int VrControllerType 
                 {
-                    get => Get<int>("vr_controller_type");
-                    set => Set<int>("vr_controller_type", value);
+                    get => Get<int>(_keyVrControllerType);
+                    set => Set<int>(_keyVrControllerType, value);
                 }
             }
 
@@ -3463,74 +3760,83 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // either a weapon such as 'tmp' or 'hegrenade', or an item such as 'nvgs'
+                private static readonly GameEventKey _keyItem = new("item");
                 public string Item 
                 {
-                    get => Get<string>("item");
-                    set => Set<string>("item", value);
+                    get => Get<string>(_keyItem);
+                    set => Set<string>(_keyItem, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDefindex = new("defindex");
                 public long Defindex 
                 {
-                    get => Get<long>("defindex");
-                    set => Set<long>("defindex", value);
+                    get => Get<long>(_keyDefindex);
+                    set => Set<long>(_keyDefindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCanzoom = new("canzoom");
                 public bool Canzoom 
                 {
-                    get => Get<bool>("canzoom");
-                    set => Set<bool>("canzoom", value);
+                    get => Get<bool>(_keyCanzoom);
+                    set => Set<bool>(_keyCanzoom, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHassilencer = new("hassilencer");
                 public bool Hassilencer 
                 {
-                    get => Get<bool>("hassilencer");
-                    set => Set<bool>("hassilencer", value);
+                    get => Get<bool>(_keyHassilencer);
+                    set => Set<bool>(_keyHassilencer, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyIssilenced = new("issilenced");
                 public bool Issilenced 
                 {
-                    get => Get<bool>("issilenced");
-                    set => Set<bool>("issilenced", value);
+                    get => Get<bool>(_keyIssilenced);
+                    set => Set<bool>(_keyIssilenced, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHastracers = new("hastracers");
                 public bool Hastracers 
                 {
-                    get => Get<bool>("hastracers");
-                    set => Set<bool>("hastracers", value);
+                    get => Get<bool>(_keyHastracers);
+                    set => Set<bool>(_keyHastracers, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyWeptype = new("weptype");
                 public int Weptype 
                 {
-                    get => Get<int>("weptype");
-                    set => Set<int>("weptype", value);
+                    get => Get<int>(_keyWeptype);
+                    set => Set<int>(_keyWeptype, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyIspainted = new("ispainted");
                 public bool Ispainted 
                 {
-                    get => Get<bool>("ispainted");
-                    set => Set<bool>("ispainted", value);
+                    get => Get<bool>(_keyIspainted);
+                    set => Set<bool>(_keyIspainted, value);
                 }
             }
 
@@ -3543,34 +3849,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // either a weapon such as 'tmp' or 'hegrenade', or an item such as 'nvgs'
+                private static readonly GameEventKey _keyItem = new("item");
                 public string Item 
                 {
-                    get => Get<string>("item");
-                    set => Set<string>("item", value);
+                    get => Get<string>(_keyItem);
+                    set => Set<string>(_keyItem, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySilent = new("silent");
                 public bool Silent 
                 {
-                    get => Get<bool>("silent");
-                    set => Set<bool>("silent", value);
+                    get => Get<bool>(_keySilent);
+                    set => Set<bool>(_keySilent, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDefindex = new("defindex");
                 public long Defindex 
                 {
-                    get => Get<long>("defindex");
-                    set => Set<long>("defindex", value);
+                    get => Get<long>(_keyDefindex);
+                    set => Set<long>(_keyDefindex, value);
                 }
             }
 
@@ -3583,34 +3893,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyItem = new("item");
                 public string Item 
                 {
-                    get => Get<string>("item");
-                    set => Set<string>("item", value);
+                    get => Get<string>(_keyItem);
+                    set => Set<string>(_keyItem, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyReason = new("reason");
                 public int Reason 
                 {
-                    get => Get<int>("reason");
-                    set => Set<int>("reason", value);
+                    get => Get<int>(_keyReason);
+                    set => Set<int>(_keyReason, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyLimit = new("limit");
                 public int Limit 
                 {
-                    get => Get<int>("limit");
-                    set => Set<int>("limit", value);
+                    get => Get<int>(_keyLimit);
+                    set => Set<int>(_keyLimit, value);
                 }
             }
 
@@ -3623,26 +3937,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyIndex = new("index");
                 public int Index 
                 {
-                    get => Get<int>("index");
-                    set => Set<int>("index", value);
+                    get => Get<int>(_keyIndex);
+                    set => Set<int>(_keyIndex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBehavior = new("behavior");
                 public int Behavior 
                 {
-                    get => Get<int>("behavior");
-                    set => Set<int>("behavior", value);
+                    get => Get<int>(_keyBehavior);
+                    set => Set<int>(_keyBehavior, value);
                 }
             }
 
@@ -3655,34 +3972,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyLoadout = new("loadout");
                 public int Loadout 
                 {
-                    get => Get<int>("loadout");
-                    set => Set<int>("loadout", value);
+                    get => Get<int>(_keyLoadout);
+                    set => Set<int>(_keyLoadout, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
             }
 
@@ -3695,26 +4016,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // either a weapon such as 'tmp' or 'hegrenade', or an item such as 'nvgs'
+                private static readonly GameEventKey _keyItem = new("item");
                 public string Item 
                 {
-                    get => Get<string>("item");
-                    set => Set<string>("item", value);
+                    get => Get<string>(_keyItem);
+                    set => Set<string>(_keyItem, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDefindex = new("defindex");
                 public long Defindex 
                 {
-                    get => Get<long>("defindex");
-                    set => Set<long>("defindex", value);
+                    get => Get<long>(_keyDefindex);
+                    set => Set<long>(_keyDefindex, value);
                 }
             }
 
@@ -3736,42 +4060,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // entity used by player
+                private static readonly GameEventKey _keyPlayer = new("player");
                 public CCSPlayerController Player 
                 {
-                    get => Get<CCSPlayerController>("player");
-                    set => Set<CCSPlayerController>("player", value);
+                    get => Get<CCSPlayerController>(_keyPlayer);
+                    set => Set<CCSPlayerController>(_keyPlayer, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyItemdef = new("itemdef");
                 public long Itemdef 
                 {
-                    get => Get<long>("itemdef");
-                    set => Set<long>("itemdef", value);
+                    get => Get<long>(_keyItemdef);
+                    set => Set<long>(_keyItemdef, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumgifts = new("numgifts");
                 public int Numgifts 
                 {
-                    get => Get<int>("numgifts");
-                    set => Set<int>("numgifts", value);
+                    get => Get<int>(_keyNumgifts);
+                    set => Set<int>(_keyNumgifts, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyGiftidx = new("giftidx");
                 public long Giftidx 
                 {
-                    get => Get<long>("giftidx");
-                    set => Set<long>("giftidx", value);
+                    get => Get<long>(_keyGiftidx);
+                    set => Set<long>(_keyGiftidx, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAccountid = new("accountid");
                 public long Accountid 
                 {
-                    get => Get<long>("accountid");
-                    set => Set<long>("accountid", value);
+                    get => Get<long>(_keyAccountid);
+                    set => Set<long>(_keyAccountid, value);
                 }
             }
 
@@ -3784,18 +4113,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // 0 = team_full
+                private static readonly GameEventKey _keyReason = new("reason");
                 public int Reason 
                 {
-                    get => Get<int>("reason");
-                    set => Set<int>("reason", value);
+                    get => Get<int>(_keyReason);
+                    set => Set<int>(_keyReason, value);
                 }
             }
 
@@ -3835,18 +4166,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player entindex
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // type of crate (metal, wood, or paradrop)
+                private static readonly GameEventKey _keyType = new("type");
                 public string Type 
                 {
-                    get => Get<string>("type");
-                    set => Set<string>("type", value);
+                    get => Get<string>(_keyType);
+                    set => Set<string>(_keyType, value);
                 }
             }
 
@@ -3859,26 +4192,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player entindex
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // crate entindex
+                private static readonly GameEventKey _keySubject = new("subject");
                 public int Subject 
                 {
-                    get => Get<int>("subject");
-                    set => Set<int>("subject", value);
+                    get => Get<int>(_keySubject);
+                    set => Set<int>(_keySubject, value);
                 }
 
                 
                 // type of crate (metal, wood, or paradrop)
+                private static readonly GameEventKey _keyType = new("type");
                 public string Type 
                 {
-                    get => Get<string>("type");
-                    set => Set<string>("type", value);
+                    get => Get<string>(_keyType);
+                    set => Set<string>(_keyType, value);
                 }
             }
 
@@ -3909,34 +4245,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyFrags = new("frags");
                 public long Frags 
                 {
-                    get => Get<long>("frags");
-                    set => Set<long>("frags", value);
+                    get => Get<long>(_keyFrags);
+                    set => Set<long>(_keyFrags, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyMaxRounds = new("max_rounds");
                 public long MaxRounds 
                 {
-                    get => Get<long>("max_rounds");
-                    set => Set<long>("max_rounds", value);
+                    get => Get<long>(_keyMaxRounds);
+                    set => Set<long>(_keyMaxRounds, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyWinRounds = new("win_rounds");
                 public long WinRounds 
                 {
-                    get => Get<long>("win_rounds");
-                    set => Set<long>("win_rounds", value);
+                    get => Get<long>(_keyWinRounds);
+                    set => Set<long>(_keyWinRounds, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTime = new("time");
                 public long Time 
                 {
-                    get => Get<long>("time");
-                    set => Set<long>("time", value);
+                    get => Get<long>(_keyTime);
+                    set => Set<long>(_keyTime, value);
                 }
             }
 
@@ -3976,34 +4316,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -4016,18 +4360,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyArea = new("area");
                 public long Area 
                 {
-                    get => Get<long>("area");
-                    set => Set<long>("area", value);
+                    get => Get<long>(_keyArea);
+                    set => Set<long>(_keyArea, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBlocked = new("blocked");
                 public bool Blocked 
                 {
-                    get => Get<bool>("blocked");
-                    set => Set<bool>("blocked", value);
+                    get => Get<bool>(_keyBlocked);
+                    set => Set<bool>(_keyBlocked, value);
                 }
             }
 
@@ -4049,26 +4395,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyNextlevel = new("nextlevel");
                 public string Nextlevel 
                 {
-                    get => Get<string>("nextlevel");
-                    set => Set<string>("nextlevel", value);
+                    get => Get<string>(_keyNextlevel);
+                    set => Set<string>(_keyNextlevel, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyMapgroup = new("mapgroup");
                 public string Mapgroup 
                 {
-                    get => Get<string>("mapgroup");
-                    set => Set<string>("mapgroup", value);
+                    get => Get<string>(_keyMapgroup);
+                    set => Set<string>(_keyMapgroup, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySkirmishmode = new("skirmishmode");
                 public string Skirmishmode 
                 {
-                    get => Get<string>("skirmishmode");
-                    set => Set<string>("skirmishmode", value);
+                    get => Get<string>(_keySkirmishmode);
+                    set => Set<string>(_keySkirmishmode, value);
                 }
             }
 
@@ -4081,26 +4430,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player entindex
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // crate entindex
+                private static readonly GameEventKey _keySubject = new("subject");
                 public int Subject 
                 {
-                    get => Get<int>("subject");
-                    set => Set<int>("subject", value);
+                    get => Get<int>(_keySubject);
+                    set => Set<int>(_keySubject, value);
                 }
 
                 
                 // type of crate (metal, wood, or paradrop)
+                private static readonly GameEventKey _keyType = new("type");
                 public string Type 
                 {
-                    get => Get<string>("type");
-                    set => Set<string>("type", value);
+                    get => Get<string>(_keyType);
+                    set => Set<string>(_keyType, value);
                 }
             }
 
@@ -4113,98 +4465,110 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // other entity ID who died
+                private static readonly GameEventKey _keyOtherid = new("otherid");
                 public int Otherid 
                 {
-                    get => Get<int>("otherid");
-                    set => Set<int>("otherid", value);
+                    get => Get<int>(_keyOtherid);
+                    set => Set<int>(_keyOtherid, value);
                 }
 
                 
                 // other entity type
+                private static readonly GameEventKey _keyOthertype = new("othertype");
                 public string Othertype 
                 {
-                    get => Get<string>("othertype");
-                    set => Set<string>("othertype", value);
+                    get => Get<string>(_keyOthertype);
+                    set => Set<string>(_keyOthertype, value);
                 }
 
                 
                 // user ID who killed
+                private static readonly GameEventKey _keyAttacker = new("attacker");
                 public int Attacker 
                 {
-                    get => Get<int>("attacker");
-                    set => Set<int>("attacker", value);
+                    get => Get<int>(_keyAttacker);
+                    set => Set<int>(_keyAttacker, value);
                 }
 
                 
                 // weapon name killer used
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
 
                 
                 // inventory item id of weapon killer used
+                private static readonly GameEventKey _keyWeaponItemid = new("weapon_itemid");
                 public string WeaponItemid 
                 {
-                    get => Get<string>("weapon_itemid");
-                    set => Set<string>("weapon_itemid", value);
+                    get => Get<string>(_keyWeaponItemid);
+                    set => Set<string>(_keyWeaponItemid, value);
                 }
 
                 
                 // faux item id of weapon killer used
+                private static readonly GameEventKey _keyWeaponFauxitemid = new("weapon_fauxitemid");
                 public string WeaponFauxitemid 
                 {
-                    get => Get<string>("weapon_fauxitemid");
-                    set => Set<string>("weapon_fauxitemid", value);
+                    get => Get<string>(_keyWeaponFauxitemid);
+                    set => Set<string>(_keyWeaponFauxitemid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyWeaponOriginalownerXuid = new("weapon_originalowner_xuid");
                 public string WeaponOriginalownerXuid 
                 {
-                    get => Get<string>("weapon_originalowner_xuid");
-                    set => Set<string>("weapon_originalowner_xuid", value);
+                    get => Get<string>(_keyWeaponOriginalownerXuid);
+                    set => Set<string>(_keyWeaponOriginalownerXuid, value);
                 }
 
                 
                 // singals a headshot
+                private static readonly GameEventKey _keyHeadshot = new("headshot");
                 public bool Headshot 
                 {
-                    get => Get<bool>("headshot");
-                    set => Set<bool>("headshot", value);
+                    get => Get<bool>(_keyHeadshot);
+                    set => Set<bool>(_keyHeadshot, value);
                 }
 
                 
                 // number of objects shot penetrated before killing target
+                private static readonly GameEventKey _keyPenetrated = new("penetrated");
                 public int Penetrated 
                 {
-                    get => Get<int>("penetrated");
-                    set => Set<int>("penetrated", value);
+                    get => Get<int>(_keyPenetrated);
+                    set => Set<int>(_keyPenetrated, value);
                 }
 
                 
                 // kill happened without a scope, used for death notice icon
+                private static readonly GameEventKey _keyNoscope = new("noscope");
                 public bool Noscope 
                 {
-                    get => Get<bool>("noscope");
-                    set => Set<bool>("noscope", value);
+                    get => Get<bool>(_keyNoscope);
+                    set => Set<bool>(_keyNoscope, value);
                 }
 
                 
                 // hitscan weapon went through smoke grenade
+                private static readonly GameEventKey _keyThrusmoke = new("thrusmoke");
                 public bool Thrusmoke 
                 {
-                    get => Get<bool>("thrusmoke");
-                    set => Set<bool>("thrusmoke", value);
+                    get => Get<bool>(_keyThrusmoke);
+                    set => Set<bool>(_keyThrusmoke, value);
                 }
 
                 
                 // attacker was blind from flashbang
+                private static readonly GameEventKey _keyAttackerblind = new("attackerblind");
                 public bool Attackerblind 
                 {
-                    get => Get<bool>("attackerblind");
-                    set => Set<bool>("attackerblind", value);
+                    get => Get<bool>(_keyAttackerblind);
+                    set => Set<bool>(_keyAttackerblind, value);
                 }
             }
 
@@ -4217,10 +4581,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4233,10 +4598,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4249,10 +4615,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // entity picked up
+                private static readonly GameEventKey _keyTarget = new("target");
                 public IntPtr Target 
                 {
-                    get => Get<IntPtr>("target");
-                    set => Set<IntPtr>("target", value);
+                    get => Get<IntPtr>(_keyTarget);
+                    set => Set<IntPtr>(_keyTarget, value);
                 }
             }
 
@@ -4265,10 +4632,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4281,18 +4649,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyAvengerId = new("avenger_id");
                 public CCSPlayerController AvengerId 
                 {
-                    get => Get<CCSPlayerController>("avenger_id");
-                    set => Set<CCSPlayerController>("avenger_id", value);
+                    get => Get<CCSPlayerController>(_keyAvengerId);
+                    set => Set<CCSPlayerController>(_keyAvengerId, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAvengedPlayerId = new("avenged_player_id");
                 public CCSPlayerController AvengedPlayerId 
                 {
-                    get => Get<CCSPlayerController>("avenged_player_id");
-                    set => Set<CCSPlayerController>("avenged_player_id", value);
+                    get => Get<CCSPlayerController>(_keyAvengedPlayerId);
+                    set => Set<CCSPlayerController>(_keyAvengedPlayerId, value);
                 }
             }
 
@@ -4305,34 +4675,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // user ID who threw the flash
+                private static readonly GameEventKey _keyAttacker = new("attacker");
                 public CCSPlayerController Attacker 
                 {
-                    get => Get<CCSPlayerController>("attacker");
-                    set => Set<CCSPlayerController>("attacker", value);
+                    get => Get<CCSPlayerController>(_keyAttacker);
+                    set => Set<CCSPlayerController>(_keyAttacker, value);
                 }
 
                 
                 // the flashbang going off
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBlindDuration = new("blind_duration");
                 public float BlindDuration 
                 {
-                    get => Get<float>("blind_duration");
-                    set => Set<float>("blind_duration", value);
+                    get => Get<float>(_keyBlindDuration);
+                    set => Set<float>(_keyBlindDuration, value);
                 }
             }
 
@@ -4345,26 +4719,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // players old (current) name
+                private static readonly GameEventKey _keyOldname = new("oldname");
                 public string Oldname 
                 {
-                    get => Get<string>("oldname");
-                    set => Set<string>("oldname", value);
+                    get => Get<string>(_keyOldname);
+                    set => Set<string>(_keyOldname, value);
                 }
 
                 
                 // players new name
+                private static readonly GameEventKey _keyNewname = new("newname");
                 public string Newname 
                 {
-                    get => Get<string>("newname");
-                    set => Set<string>("newname", value);
+                    get => Get<string>(_keyNewname);
+                    set => Set<string>(_keyNewname, value);
                 }
             }
 
@@ -4377,26 +4754,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // true if team only chat
+                private static readonly GameEventKey _keyTeamonly = new("teamonly");
                 public bool Teamonly 
                 {
-                    get => Get<bool>("teamonly");
-                    set => Set<bool>("teamonly", value);
+                    get => Get<bool>(_keyTeamonly);
+                    set => Set<bool>(_keyTeamonly, value);
                 }
 
                 
                 // chatting player
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public int Userid 
                 {
-                    get => Get<int>("userid");
-                    set => Set<int>("userid", value);
+                    get => Get<int>(_keyUserid);
+                    set => Set<int>(_keyUserid, value);
                 }
 
                 
                 // chat text
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
             }
 
@@ -4409,50 +4789,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player name
+                private static readonly GameEventKey _keyName = new("name");
                 public string Name 
                 {
-                    get => Get<string>("name");
-                    set => Set<string>("name", value);
+                    get => Get<string>(_keyName);
+                    set => Set<string>(_keyName, value);
                 }
 
                 
                 // user ID on server (unique on server)
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // player network (i.e steam) id
+                private static readonly GameEventKey _keyNetworkid = new("networkid");
                 public string Networkid 
                 {
-                    get => Get<string>("networkid");
-                    set => Set<string>("networkid", value);
+                    get => Get<string>(_keyNetworkid);
+                    set => Set<string>(_keyNetworkid, value);
                 }
 
                 
                 // steam id
+                private static readonly GameEventKey _keyXuid = new("xuid");
                 public ulong Xuid 
                 {
-                    get => Get<ulong>("xuid");
-                    set => Set<ulong>("xuid", value);
+                    get => Get<ulong>(_keyXuid);
+                    set => Set<ulong>(_keyXuid, value);
                 }
 
                 
                 // ip:port
+                private static readonly GameEventKey _keyAddress = new("address");
                 public string Address 
                 {
-                    get => Get<string>("address");
-                    set => Set<string>("address", value);
+                    get => Get<string>(_keyAddress);
+                    set => Set<string>(_keyAddress, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyBot = new("bot");
                 public bool Bot 
                 {
-                    get => Get<bool>("bot");
-                    set => Set<bool>("bot", value);
+                    get => Get<bool>(_keyBot);
+                    set => Set<bool>(_keyBot, value);
                 }
             }
 
@@ -4465,10 +4851,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server (unique on server)
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4481,170 +4868,191 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user who died
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // player who killed
+                private static readonly GameEventKey _keyAttacker = new("attacker");
                 public CCSPlayerController Attacker 
                 {
-                    get => Get<CCSPlayerController>("attacker");
-                    set => Set<CCSPlayerController>("attacker", value);
+                    get => Get<CCSPlayerController>(_keyAttacker);
+                    set => Set<CCSPlayerController>(_keyAttacker, value);
                 }
 
                 
                 // player who assisted in the kill
+                private static readonly GameEventKey _keyAssister = new("assister");
                 public CCSPlayerController Assister 
                 {
-                    get => Get<CCSPlayerController>("assister");
-                    set => Set<CCSPlayerController>("assister", value);
+                    get => Get<CCSPlayerController>(_keyAssister);
+                    set => Set<CCSPlayerController>(_keyAssister, value);
                 }
 
                 
                 // assister helped with a flash
+                private static readonly GameEventKey _keyAssistedflash = new("assistedflash");
                 public bool Assistedflash 
                 {
-                    get => Get<bool>("assistedflash");
-                    set => Set<bool>("assistedflash", value);
+                    get => Get<bool>(_keyAssistedflash);
+                    set => Set<bool>(_keyAssistedflash, value);
                 }
 
                 
                 // weapon name killer used
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
 
                 
                 // inventory item id of weapon killer used
+                private static readonly GameEventKey _keyWeaponItemid = new("weapon_itemid");
                 public string WeaponItemid 
                 {
-                    get => Get<string>("weapon_itemid");
-                    set => Set<string>("weapon_itemid", value);
+                    get => Get<string>(_keyWeaponItemid);
+                    set => Set<string>(_keyWeaponItemid, value);
                 }
 
                 
                 // faux item id of weapon killer used
+                private static readonly GameEventKey _keyWeaponFauxitemid = new("weapon_fauxitemid");
                 public string WeaponFauxitemid 
                 {
-                    get => Get<string>("weapon_fauxitemid");
-                    set => Set<string>("weapon_fauxitemid", value);
+                    get => Get<string>(_keyWeaponFauxitemid);
+                    set => Set<string>(_keyWeaponFauxitemid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyWeaponOriginalownerXuid = new("weapon_originalowner_xuid");
                 public string WeaponOriginalownerXuid 
                 {
-                    get => Get<string>("weapon_originalowner_xuid");
-                    set => Set<string>("weapon_originalowner_xuid", value);
+                    get => Get<string>(_keyWeaponOriginalownerXuid);
+                    set => Set<string>(_keyWeaponOriginalownerXuid, value);
                 }
 
                 
                 // singals a headshot
+                private static readonly GameEventKey _keyHeadshot = new("headshot");
                 public bool Headshot 
                 {
-                    get => Get<bool>("headshot");
-                    set => Set<bool>("headshot", value);
+                    get => Get<bool>(_keyHeadshot);
+                    set => Set<bool>(_keyHeadshot, value);
                 }
 
                 
                 // did killer dominate victim with this kill
+                private static readonly GameEventKey _keyDominated = new("dominated");
                 public int Dominated 
                 {
-                    get => Get<int>("dominated");
-                    set => Set<int>("dominated", value);
+                    get => Get<int>(_keyDominated);
+                    set => Set<int>(_keyDominated, value);
                 }
 
                 
                 // did killer get revenge on victim with this kill
+                private static readonly GameEventKey _keyRevenge = new("revenge");
                 public int Revenge 
                 {
-                    get => Get<int>("revenge");
-                    set => Set<int>("revenge", value);
+                    get => Get<int>(_keyRevenge);
+                    set => Set<int>(_keyRevenge, value);
                 }
 
                 
                 // is the kill resulting in squad wipe
+                private static readonly GameEventKey _keyWipe = new("wipe");
                 public int Wipe 
                 {
-                    get => Get<int>("wipe");
-                    set => Set<int>("wipe", value);
+                    get => Get<int>(_keyWipe);
+                    set => Set<int>(_keyWipe, value);
                 }
 
                 
                 // number of objects shot penetrated before killing target
+                private static readonly GameEventKey _keyPenetrated = new("penetrated");
                 public int Penetrated 
                 {
-                    get => Get<int>("penetrated");
-                    set => Set<int>("penetrated", value);
+                    get => Get<int>(_keyPenetrated);
+                    set => Set<int>(_keyPenetrated, value);
                 }
 
                 
                 // if replay data is unavailable, this will be present and set to false
+                private static readonly GameEventKey _keyNoreplay = new("noreplay");
                 public bool Noreplay 
                 {
-                    get => Get<bool>("noreplay");
-                    set => Set<bool>("noreplay", value);
+                    get => Get<bool>(_keyNoreplay);
+                    set => Set<bool>(_keyNoreplay, value);
                 }
 
                 
                 // kill happened without a scope, used for death notice icon
+                private static readonly GameEventKey _keyNoscope = new("noscope");
                 public bool Noscope 
                 {
-                    get => Get<bool>("noscope");
-                    set => Set<bool>("noscope", value);
+                    get => Get<bool>(_keyNoscope);
+                    set => Set<bool>(_keyNoscope, value);
                 }
 
                 
                 // hitscan weapon went through smoke grenade
+                private static readonly GameEventKey _keyThrusmoke = new("thrusmoke");
                 public bool Thrusmoke 
                 {
-                    get => Get<bool>("thrusmoke");
-                    set => Set<bool>("thrusmoke", value);
+                    get => Get<bool>(_keyThrusmoke);
+                    set => Set<bool>(_keyThrusmoke, value);
                 }
 
                 
                 // attacker was blind from flashbang
+                private static readonly GameEventKey _keyAttackerblind = new("attackerblind");
                 public bool Attackerblind 
                 {
-                    get => Get<bool>("attackerblind");
-                    set => Set<bool>("attackerblind", value);
+                    get => Get<bool>(_keyAttackerblind);
+                    set => Set<bool>(_keyAttackerblind, value);
                 }
 
                 
                 // distance to victim in meters
+                private static readonly GameEventKey _keyDistance = new("distance");
                 public float Distance 
                 {
-                    get => Get<float>("distance");
-                    set => Set<float>("distance", value);
+                    get => Get<float>(_keyDistance);
+                    set => Set<float>(_keyDistance, value);
                 }
 
                 
                 // damage done to health
+                private static readonly GameEventKey _keyDmgHealth = new("dmg_health");
                 public int DmgHealth 
                 {
-                    get => Get<int>("dmg_health");
-                    set => Set<int>("dmg_health", value);
+                    get => Get<int>(_keyDmgHealth);
+                    set => Set<int>(_keyDmgHealth, value);
                 }
 
                 
                 // damage done to armor
+                private static readonly GameEventKey _keyDmgArmor = new("dmg_armor");
                 public int DmgArmor 
                 {
-                    get => Get<int>("dmg_armor");
-                    set => Set<int>("dmg_armor", value);
+                    get => Get<int>(_keyDmgArmor);
+                    set => Set<int>(_keyDmgArmor, value);
                 }
 
                 
                 // hitgroup that was damaged
+                private static readonly GameEventKey _keyHitgroup = new("hitgroup");
                 public int Hitgroup 
                 {
-                    get => Get<int>("hitgroup");
-                    set => Set<int>("hitgroup", value);
+                    get => Get<int>(_keyHitgroup);
+                    set => Set<int>(_keyHitgroup, value);
                 }
             }
 
@@ -4657,10 +5065,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4673,50 +5082,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // see networkdisconnect enum protobuf
+                private static readonly GameEventKey _keyReason = new("reason");
                 public int Reason 
                 {
-                    get => Get<int>("reason");
-                    set => Set<int>("reason", value);
+                    get => Get<int>(_keyReason);
+                    set => Set<int>(_keyReason, value);
                 }
 
                 
                 // player name
+                private static readonly GameEventKey _keyName = new("name");
                 public string Name 
                 {
-                    get => Get<string>("name");
-                    set => Set<string>("name", value);
+                    get => Get<string>(_keyName);
+                    set => Set<string>(_keyName, value);
                 }
 
                 
                 // player network (i.e steam) id
+                private static readonly GameEventKey _keyNetworkid = new("networkid");
                 public string Networkid 
                 {
-                    get => Get<string>("networkid");
-                    set => Set<string>("networkid", value);
+                    get => Get<string>(_keyNetworkid);
+                    set => Set<string>(_keyNetworkid, value);
                 }
 
                 
                 // steam id
+                private static readonly GameEventKey _keyXuid = new("xuid");
                 public ulong Xuid 
                 {
-                    get => Get<ulong>("xuid");
-                    set => Set<ulong>("xuid", value);
+                    get => Get<ulong>(_keyXuid);
+                    set => Set<ulong>(_keyXuid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPlayerid = new("PlayerID");
                 public int Playerid 
                 {
-                    get => Get<int>("PlayerID");
-                    set => Set<int>("PlayerID", value);
+                    get => Get<int>(_keyPlayerid);
+                    set => Set<int>(_keyPlayerid, value);
                 }
             }
 
@@ -4729,18 +5144,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDamage = new("damage");
                 public float Damage 
                 {
-                    get => Get<float>("damage");
-                    set => Set<float>("damage", value);
+                    get => Get<float>(_keyDamage);
+                    set => Set<float>(_keyDamage, value);
                 }
             }
 
@@ -4753,10 +5170,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4769,18 +5187,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // Number of this full update
+                private static readonly GameEventKey _keyCount = new("count");
                 public int Count 
                 {
-                    get => Get<int>("count");
-                    set => Set<int>("count", value);
+                    get => Get<int>(_keyCount);
+                    set => Set<int>(_keyCount, value);
                 }
             }
 
@@ -4793,10 +5213,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID who received the c4
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4809,10 +5230,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // localizable string of a hint
+                private static readonly GameEventKey _keyHintmessage = new("hintmessage");
                 public string Hintmessage 
                 {
-                    get => Get<string>("hintmessage");
-                    set => Set<string>("hintmessage", value);
+                    get => Get<string>(_keyHintmessage);
+                    set => Set<string>(_keyHintmessage, value);
                 }
             }
 
@@ -4825,66 +5247,74 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player index who was hurt
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // player index who attacked
+                private static readonly GameEventKey _keyAttacker = new("attacker");
                 public CCSPlayerController Attacker 
                 {
-                    get => Get<CCSPlayerController>("attacker");
-                    set => Set<CCSPlayerController>("attacker", value);
+                    get => Get<CCSPlayerController>(_keyAttacker);
+                    set => Set<CCSPlayerController>(_keyAttacker, value);
                 }
 
                 
                 // remaining health points
+                private static readonly GameEventKey _keyHealth = new("health");
                 public int Health 
                 {
-                    get => Get<int>("health");
-                    set => Set<int>("health", value);
+                    get => Get<int>(_keyHealth);
+                    set => Set<int>(_keyHealth, value);
                 }
 
                 
                 // remaining armor points
+                private static readonly GameEventKey _keyArmor = new("armor");
                 public int Armor 
                 {
-                    get => Get<int>("armor");
-                    set => Set<int>("armor", value);
+                    get => Get<int>(_keyArmor);
+                    set => Set<int>(_keyArmor, value);
                 }
 
                 
                 // weapon name attacker used, if not the world
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
 
                 
                 // damage done to health
+                private static readonly GameEventKey _keyDmgHealth = new("dmg_health");
                 public int DmgHealth 
                 {
-                    get => Get<int>("dmg_health");
-                    set => Set<int>("dmg_health", value);
+                    get => Get<int>(_keyDmgHealth);
+                    set => Set<int>(_keyDmgHealth, value);
                 }
 
                 
                 // damage done to armor
+                private static readonly GameEventKey _keyDmgArmor = new("dmg_armor");
                 public int DmgArmor 
                 {
-                    get => Get<int>("dmg_armor");
-                    set => Set<int>("dmg_armor", value);
+                    get => Get<int>(_keyDmgArmor);
+                    set => Set<int>(_keyDmgArmor, value);
                 }
 
                 
                 // hitgroup that was damaged
+                private static readonly GameEventKey _keyHitgroup = new("hitgroup");
                 public int Hitgroup 
                 {
-                    get => Get<int>("hitgroup");
-                    set => Set<int>("hitgroup", value);
+                    get => Get<int>(_keyHitgroup);
+                    set => Set<int>(_keyHitgroup, value);
                 }
             }
 
@@ -4897,34 +5327,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player name
+                private static readonly GameEventKey _keyName = new("name");
                 public string Name 
                 {
-                    get => Get<string>("name");
-                    set => Set<string>("name", value);
+                    get => Get<string>(_keyName);
+                    set => Set<string>(_keyName, value);
                 }
 
                 
                 // user ID on server (unique on server)
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // player network (i.e steam) id
+                private static readonly GameEventKey _keySteamid = new("steamid");
                 public ulong Steamid 
                 {
-                    get => Get<ulong>("steamid");
-                    set => Set<ulong>("steamid", value);
+                    get => Get<ulong>(_keySteamid);
+                    set => Set<ulong>(_keySteamid, value);
                 }
 
                 
                 // true if player is a AI bot
+                private static readonly GameEventKey _keyBot = new("bot");
                 public bool Bot 
                 {
-                    get => Get<bool>("bot");
-                    set => Set<bool>("bot", value);
+                    get => Get<bool>(_keyBot);
+                    set => Set<bool>(_keyBot, value);
                 }
             }
 
@@ -4937,10 +5371,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -4953,50 +5388,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyUrgent = new("urgent");
                 public bool Urgent 
                 {
-                    get => Get<bool>("urgent");
-                    set => Set<bool>("urgent", value);
+                    get => Get<bool>(_keyUrgent);
+                    set => Set<bool>(_keyUrgent, value);
                 }
             }
 
@@ -5009,10 +5450,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
             }
 
@@ -5025,18 +5467,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot = new("slot");
                 public int Slot 
                 {
-                    get => Get<int>("slot");
-                    set => Set<int>("slot", value);
+                    get => Get<int>(_keySlot);
+                    set => Set<int>(_keySlot, value);
                 }
             }
 
@@ -5049,18 +5493,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVote = new("vote");
                 public bool Vote 
                 {
-                    get => Get<bool>("vote");
-                    set => Set<bool>("vote", value);
+                    get => Get<bool>(_keyVote);
+                    set => Set<bool>(_keyVote, value);
                 }
             }
 
@@ -5073,34 +5519,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // # of kills
+                private static readonly GameEventKey _keyKills = new("kills");
                 public int Kills 
                 {
-                    get => Get<int>("kills");
-                    set => Set<int>("kills", value);
+                    get => Get<int>(_keyKills);
+                    set => Set<int>(_keyKills, value);
                 }
 
                 
                 // # of deaths
+                private static readonly GameEventKey _keyDeaths = new("deaths");
                 public int Deaths 
                 {
-                    get => Get<int>("deaths");
-                    set => Set<int>("deaths", value);
+                    get => Get<int>(_keyDeaths);
+                    set => Set<int>(_keyDeaths, value);
                 }
 
                 
                 // total game score
+                private static readonly GameEventKey _keyScore = new("score");
                 public int Score 
                 {
-                    get => Get<int>("score");
-                    set => Set<int>("score", value);
+                    get => Get<int>(_keyScore);
+                    set => Set<int>(_keyScore, value);
                 }
             }
 
@@ -5113,26 +5563,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID on server
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // weapon ID
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public int Weapon 
                 {
-                    get => Get<int>("weapon");
-                    set => Set<int>("weapon", value);
+                    get => Get<int>(_keyWeapon);
+                    set => Set<int>(_keyWeapon, value);
                 }
 
                 
                 // weapon mode
+                private static readonly GameEventKey _keyMode = new("mode");
                 public int Mode 
                 {
-                    get => Get<int>("mode");
-                    set => Set<int>("mode", value);
+                    get => Get<int>(_keyMode);
+                    set => Set<int>(_keyMode, value);
                 }
             }
 
@@ -5145,34 +5598,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyRadius = new("radius");
                 public int Radius 
                 {
-                    get => Get<int>("radius");
-                    set => Set<int>("radius", value);
+                    get => Get<int>(_keyRadius);
+                    set => Set<int>(_keyRadius, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDuration = new("duration");
                 public float Duration 
                 {
-                    get => Get<float>("duration");
-                    set => Set<float>("duration", value);
+                    get => Get<float>(_keyDuration);
+                    set => Set<float>(_keyDuration, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyStep = new("step");
                 public bool Step 
                 {
-                    get => Get<bool>("step");
-                    set => Set<bool>("step", value);
+                    get => Get<bool>(_keyStep);
+                    set => Set<bool>(_keyStep, value);
                 }
             }
 
@@ -5185,10 +5642,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -5201,18 +5659,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // true if restart is pending
+                private static readonly GameEventKey _keyInrestart = new("inrestart");
                 public bool Inrestart 
                 {
-                    get => Get<bool>("inrestart");
-                    set => Set<bool>("inrestart", value);
+                    get => Get<bool>(_keyInrestart);
+                    set => Set<bool>(_keyInrestart, value);
                 }
             }
 
@@ -5225,10 +5685,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyForceupload = new("forceupload");
                 public bool Forceupload 
                 {
-                    get => Get<bool>("forceupload");
-                    set => Set<bool>("forceupload", value);
+                    get => Get<bool>(_keyForceupload);
+                    set => Set<bool>(_keyForceupload, value);
                 }
             }
 
@@ -5241,50 +5702,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // team id
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // old team id
+                private static readonly GameEventKey _keyOldteam = new("oldteam");
                 public int Oldteam 
                 {
-                    get => Get<int>("oldteam");
-                    set => Set<int>("oldteam", value);
+                    get => Get<int>(_keyOldteam);
+                    set => Set<int>(_keyOldteam, value);
                 }
 
                 
                 // team change because player disconnects
+                private static readonly GameEventKey _keyDisconnect = new("disconnect");
                 public bool Disconnect 
                 {
-                    get => Get<bool>("disconnect");
-                    set => Set<bool>("disconnect", value);
+                    get => Get<bool>(_keyDisconnect);
+                    set => Set<bool>(_keyDisconnect, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySilent = new("silent");
                 public bool Silent 
                 {
-                    get => Get<bool>("silent");
-                    set => Set<bool>("silent", value);
+                    get => Get<bool>(_keySilent);
+                    set => Set<bool>(_keySilent, value);
                 }
 
                 
                 // true if player is a bot
+                private static readonly GameEventKey _keyIsbot = new("isbot");
                 public bool Isbot 
                 {
-                    get => Get<bool>("isbot");
-                    set => Set<bool>("isbot", value);
+                    get => Get<bool>(_keyIsbot);
+                    set => Set<bool>(_keyIsbot, value);
                 }
             }
 
@@ -5297,10 +5764,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -5313,10 +5781,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Controller id of user
+                private static readonly GameEventKey _keyControllerid = new("controllerId");
                 public int Controllerid 
                 {
-                    get => Get<int>("controllerId");
-                    set => Set<int>("controllerId", value);
+                    get => Get<int>(_keyControllerid);
+                    set => Set<int>(_keyControllerid, value);
                 }
             }
 
@@ -5329,10 +5798,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // splitscreen ID
+                private static readonly GameEventKey _keySplitscreenplayer = new("splitscreenplayer");
                 public int Splitscreenplayer 
                 {
-                    get => Get<int>("splitscreenplayer");
-                    set => Set<int>("splitscreenplayer", value);
+                    get => Get<int>(_keySplitscreenplayer);
+                    set => Set<int>(_keySplitscreenplayer, value);
                 }
             }
 
@@ -5345,10 +5815,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Controller id of user
+                private static readonly GameEventKey _keyControllerid = new("controllerId");
                 public int Controllerid 
                 {
-                    get => Get<int>("controllerId");
-                    set => Set<int>("controllerId", value);
+                    get => Get<int>(_keyControllerid);
+                    set => Set<int>(_keyControllerid, value);
                 }
             }
 
@@ -5406,50 +5877,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // winner team/user i
+                private static readonly GameEventKey _keyWinner = new("winner");
                 public int Winner 
                 {
-                    get => Get<int>("winner");
-                    set => Set<int>("winner", value);
+                    get => Get<int>(_keyWinner);
+                    set => Set<int>(_keyWinner, value);
                 }
 
                 
                 // reson why team won
+                private static readonly GameEventKey _keyReason = new("reason");
                 public int Reason 
                 {
-                    get => Get<int>("reason");
-                    set => Set<int>("reason", value);
+                    get => Get<int>(_keyReason);
+                    set => Set<int>(_keyReason, value);
                 }
 
                 
                 // end round message
+                private static readonly GameEventKey _keyMessage = new("message");
                 public string Message 
                 {
-                    get => Get<string>("message");
-                    set => Set<string>("message", value);
+                    get => Get<string>(_keyMessage);
+                    set => Set<string>(_keyMessage, value);
                 }
 
                 
                 // server-generated legacy value
+                private static readonly GameEventKey _keyLegacy = new("legacy");
                 public int Legacy 
                 {
-                    get => Get<int>("legacy");
-                    set => Set<int>("legacy", value);
+                    get => Get<int>(_keyLegacy);
+                    set => Set<int>(_keyLegacy, value);
                 }
 
                 
                 // total number of players alive at the end of round, used for statistics gathering, computed on the server in the event client is in replay when receiving this message
+                private static readonly GameEventKey _keyPlayerCount = new("player_count");
                 public int PlayerCount 
                 {
-                    get => Get<int>("player_count");
-                    set => Set<int>("player_count", value);
+                    get => Get<int>(_keyPlayerCount);
+                    set => Set<int>(_keyPlayerCount, value);
                 }
 
                 
                 // if set, don't play round end music, because action is still on-going
+                private static readonly GameEventKey _keyNomusic = new("nomusic");
                 public int Nomusic 
                 {
-                    get => Get<int>("nomusic");
-                    set => Set<int>("nomusic", value);
+                    get => Get<int>(_keyNomusic);
+                    set => Set<int>(_keyNomusic, value);
                 }
             }
 
@@ -5480,50 +5957,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyReason = new("reason");
                 public int Reason 
                 {
-                    get => Get<int>("reason");
-                    set => Set<int>("reason", value);
+                    get => Get<int>(_keyReason);
+                    set => Set<int>(_keyReason, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyValue = new("value");
                 public long Value 
                 {
-                    get => Get<long>("value");
-                    set => Set<long>("value", value);
+                    get => Get<long>(_keyValue);
+                    set => Set<long>(_keyValue, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyMusickitmvps = new("musickitmvps");
                 public long Musickitmvps 
                 {
-                    get => Get<long>("musickitmvps");
-                    set => Set<long>("musickitmvps", value);
+                    get => Get<long>(_keyMusickitmvps);
+                    set => Set<long>(_keyMusickitmvps, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNomusic = new("nomusic");
                 public int Nomusic 
                 {
-                    get => Get<int>("nomusic");
-                    set => Set<int>("nomusic", value);
+                    get => Get<int>(_keyNomusic);
+                    set => Set<int>(_keyNomusic, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyMusickitid = new("musickitid");
                 public long Musickitid 
                 {
-                    get => Get<long>("musickitid");
-                    set => Set<long>("musickitid", value);
+                    get => Get<long>(_keyMusickitid);
+                    set => Set<long>(_keyMusickitid, value);
                 }
             }
 
@@ -5563,26 +6046,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // round time limit in seconds
+                private static readonly GameEventKey _keyTimelimit = new("timelimit");
                 public long Timelimit 
                 {
-                    get => Get<long>("timelimit");
-                    set => Set<long>("timelimit", value);
+                    get => Get<long>(_keyTimelimit);
+                    set => Set<long>(_keyTimelimit, value);
                 }
 
                 
                 // frag limit in seconds
+                private static readonly GameEventKey _keyFraglimit = new("fraglimit");
                 public long Fraglimit 
                 {
-                    get => Get<long>("fraglimit");
-                    set => Set<long>("fraglimit", value);
+                    get => Get<long>(_keyFraglimit);
+                    set => Set<long>(_keyFraglimit, value);
                 }
 
                 
                 // round objective
+                private static readonly GameEventKey _keyObjective = new("objective");
                 public string Objective 
                 {
-                    get => Get<string>("objective");
-                    set => Set<string>("objective", value);
+                    get => Get<string>(_keyObjective);
+                    set => Set<string>(_keyObjective, value);
                 }
             }
 
@@ -5622,26 +6108,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyCategory = new("category");
                 public int Category 
                 {
-                    get => Get<int>("category");
-                    set => Set<int>("category", value);
+                    get => Get<int>(_keyCategory);
+                    set => Set<int>(_keyCategory, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyRank = new("rank");
                 public int Rank 
                 {
-                    get => Get<int>("rank");
-                    set => Set<int>("rank", value);
+                    get => Get<int>(_keyRank);
+                    set => Set<int>(_keyRank, value);
                 }
             }
 
@@ -5654,18 +6143,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // cvar name, eg "mp_roundtime"
+                private static readonly GameEventKey _keyCvarname = new("cvarname");
                 public string Cvarname 
                 {
-                    get => Get<string>("cvarname");
-                    set => Set<string>("cvarname", value);
+                    get => Get<string>(_keyCvarname);
+                    set => Set<string>(_keyCvarname, value);
                 }
 
                 
                 // new cvar value
+                private static readonly GameEventKey _keyCvarvalue = new("cvarvalue");
                 public string Cvarvalue 
                 {
-                    get => Get<string>("cvarvalue");
-                    set => Set<string>("cvarvalue", value);
+                    get => Get<string>(_keyCvarvalue);
+                    set => Set<string>(_keyCvarvalue, value);
                 }
             }
 
@@ -5678,10 +6169,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // the message text
+                private static readonly GameEventKey _keyText = new("text");
                 public string Text 
                 {
-                    get => Get<string>("text");
-                    set => Set<string>("text", value);
+                    get => Get<string>(_keyText);
+                    set => Set<string>(_keyText, value);
                 }
             }
 
@@ -5694,10 +6186,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // reason why server is about to be shut down
+                private static readonly GameEventKey _keyReason = new("reason");
                 public string Reason 
                 {
-                    get => Get<string>("reason");
-                    set => Set<string>("reason", value);
+                    get => Get<string>(_keyReason);
+                    set => Set<string>(_keyReason, value);
                 }
             }
 
@@ -5710,10 +6203,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // reason why server was shut down
+                private static readonly GameEventKey _keyReason = new("reason");
                 public string Reason 
                 {
-                    get => Get<string>("reason");
-                    set => Set<string>("reason", value);
+                    get => Get<string>(_keyReason);
+                    set => Set<string>(_keyReason, value);
                 }
             }
 
@@ -5726,82 +6220,92 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // public host name
+                private static readonly GameEventKey _keyHostname = new("hostname");
                 public string Hostname 
                 {
-                    get => Get<string>("hostname");
-                    set => Set<string>("hostname", value);
+                    get => Get<string>(_keyHostname);
+                    set => Set<string>(_keyHostname, value);
                 }
 
                 
                 // hostame, IP or DNS name
+                private static readonly GameEventKey _keyAddress = new("address");
                 public string Address 
                 {
-                    get => Get<string>("address");
-                    set => Set<string>("address", value);
+                    get => Get<string>(_keyAddress);
+                    set => Set<string>(_keyAddress, value);
                 }
 
                 
                 // server port
+                private static readonly GameEventKey _keyPort = new("port");
                 public int Port 
                 {
-                    get => Get<int>("port");
-                    set => Set<int>("port", value);
+                    get => Get<int>(_keyPort);
+                    set => Set<int>(_keyPort, value);
                 }
 
                 
                 // game dir
+                private static readonly GameEventKey _keyGame = new("game");
                 public string Game 
                 {
-                    get => Get<string>("game");
-                    set => Set<string>("game", value);
+                    get => Get<string>(_keyGame);
+                    set => Set<string>(_keyGame, value);
                 }
 
                 
                 // map name
+                private static readonly GameEventKey _keyMapname = new("mapname");
                 public string Mapname 
                 {
-                    get => Get<string>("mapname");
-                    set => Set<string>("mapname", value);
+                    get => Get<string>(_keyMapname);
+                    set => Set<string>(_keyMapname, value);
                 }
 
                 
                 // addon name
+                private static readonly GameEventKey _keyAddonname = new("addonname");
                 public string Addonname 
                 {
-                    get => Get<string>("addonname");
-                    set => Set<string>("addonname", value);
+                    get => Get<string>(_keyAddonname);
+                    set => Set<string>(_keyAddonname, value);
                 }
 
                 
                 // max players
+                private static readonly GameEventKey _keyMaxplayers = new("maxplayers");
                 public long Maxplayers 
                 {
-                    get => Get<long>("maxplayers");
-                    set => Set<long>("maxplayers", value);
+                    get => Get<long>(_keyMaxplayers);
+                    set => Set<long>(_keyMaxplayers, value);
                 }
 
                 
                 // WIN32, LINUX
+                private static readonly GameEventKey _keyOs = new("os");
                 public string Os 
                 {
-                    get => Get<string>("os");
-                    set => Set<string>("os", value);
+                    get => Get<string>(_keyOs);
+                    set => Set<string>(_keyOs, value);
                 }
 
                 
                 // true if dedicated server
+                private static readonly GameEventKey _keyDedicated = new("dedicated");
                 public bool Dedicated 
                 {
-                    get => Get<bool>("dedicated");
-                    set => Set<bool>("dedicated", value);
+                    get => Get<bool>(_keyDedicated);
+                    set => Set<bool>(_keyDedicated, value);
                 }
 
                 
                 // true if password protected
+                private static readonly GameEventKey _keyPassword = new("password");
                 public bool Password 
                 {
-                    get => Get<bool>("password");
-                    set => Set<bool>("password", value);
+                    get => Get<bool>(_keyPassword);
+                    set => Set<bool>(_keyPassword, value);
                 }
             }
 
@@ -5814,18 +6318,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyGroup = new("group");
                 public string Group 
                 {
-                    get => Get<string>("group");
-                    set => Set<string>("group", value);
+                    get => Get<string>(_keyGroup);
+                    set => Set<string>(_keyGroup, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEnabled = new("enabled");
                 public int Enabled 
                 {
-                    get => Get<int>("enabled");
-                    set => Set<int>("enabled", value);
+                    get => Get<int>(_keyEnabled);
+                    set => Set<int>(_keyEnabled, value);
                 }
             }
 
@@ -5838,26 +6344,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyAction = new("action");
                 public string Action 
                 {
-                    get => Get<string>("action");
-                    set => Set<string>("action", value);
+                    get => Get<string>(_keyAction);
+                    set => Set<string>(_keyAction, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyData = new("data");
                 public string Data 
                 {
-                    get => Get<string>("data");
-                    set => Set<string>("data", value);
+                    get => Get<string>(_keyData);
+                    set => Set<string>(_keyData, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keySlot = new("slot");
                 public int Slot 
                 {
-                    get => Get<int>("slot");
-                    set => Set<int>("slot", value);
+                    get => Get<int>(_keySlot);
+                    set => Set<int>(_keySlot, value);
                 }
             }
 
@@ -5870,58 +6379,65 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // endindex of the one who was killed
+                private static readonly GameEventKey _keyVictim = new("victim");
                 public CCSPlayerController Victim 
                 {
-                    get => Get<CCSPlayerController>("victim");
-                    set => Set<CCSPlayerController>("victim", value);
+                    get => Get<CCSPlayerController>(_keyVictim);
+                    set => Set<CCSPlayerController>(_keyVictim, value);
                 }
 
                 
                 // entindex of the killer entity
+                private static readonly GameEventKey _keyKiller = new("killer");
                 public IntPtr Killer 
                 {
-                    get => Get<IntPtr>("killer");
-                    set => Set<IntPtr>("killer", value);
+                    get => Get<IntPtr>(_keyKiller);
+                    set => Set<IntPtr>(_keyKiller, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyKillerController = new("killer_controller");
                 public CCSPlayerController KillerController 
                 {
-                    get => Get<CCSPlayerController>("killer_controller");
-                    set => Set<CCSPlayerController>("killer_controller", value);
+                    get => Get<CCSPlayerController>(_keyKillerController);
+                    set => Set<CCSPlayerController>(_keyKillerController, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHitsTaken = new("hits_taken");
                 public int HitsTaken 
                 {
-                    get => Get<int>("hits_taken");
-                    set => Set<int>("hits_taken", value);
+                    get => Get<int>(_keyHitsTaken);
+                    set => Set<int>(_keyHitsTaken, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDamageTaken = new("damage_taken");
                 public int DamageTaken 
                 {
-                    get => Get<int>("damage_taken");
-                    set => Set<int>("damage_taken", value);
+                    get => Get<int>(_keyDamageTaken);
+                    set => Set<int>(_keyDamageTaken, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyHitsGiven = new("hits_given");
                 public int HitsGiven 
                 {
-                    get => Get<int>("hits_given");
-                    set => Set<int>("hits_given", value);
+                    get => Get<int>(_keyHitsGiven);
+                    set => Set<int>(_keyHitsGiven, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDamageGiven = new("damage_given");
                 public int DamageGiven 
                 {
-                    get => Get<int>("damage_given");
-                    set => Set<int>("damage_given", value);
+                    get => Get<int>(_keyDamageGiven);
+                    set => Set<int>(_keyDamageGiven, value);
                 }
             }
 
@@ -5934,26 +6450,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyLocToken = new("loc_token");
                 public string LocToken 
                 {
-                    get => Get<string>("loc_token");
-                    set => Set<string>("loc_token", value);
+                    get => Get<string>(_keyLocToken);
+                    set => Set<string>(_keyLocToken, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyDuration = new("duration");
                 public long Duration 
                 {
-                    get => Get<long>("duration");
-                    set => Set<long>("duration", value);
+                    get => Get<long>(_keyDuration);
+                    set => Set<long>(_keyDuration, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -5966,10 +6485,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -5982,10 +6502,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -5998,10 +6519,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6014,18 +6536,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyParadrop = new("paradrop");
                 public int Paradrop 
                 {
-                    get => Get<int>("paradrop");
-                    set => Set<int>("paradrop", value);
+                    get => Get<int>(_keyParadrop);
+                    set => Set<int>(_keyParadrop, value);
                 }
             }
 
@@ -6038,42 +6562,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -6086,42 +6615,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -6134,10 +6668,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // entindex of the player
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6150,18 +6685,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // spectating player
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // ehandle of the target
+                private static readonly GameEventKey _keyTarget = new("target");
                 public IntPtr Target 
                 {
-                    get => Get<IntPtr>("target");
-                    set => Set<IntPtr>("target", value);
+                    get => Get<IntPtr>(_keyTarget);
+                    set => Set<IntPtr>(_keyTarget, value);
                 }
             }
 
@@ -6183,26 +6720,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyType = new("type");
                 public int Type 
                 {
-                    get => Get<int>("type");
-                    set => Set<int>("type", value);
+                    get => Get<int>(_keyType);
+                    set => Set<int>(_keyType, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVoteParameter = new("vote_parameter");
                 public int VoteParameter 
                 {
-                    get => Get<int>("vote_parameter");
-                    set => Set<int>("vote_parameter", value);
+                    get => Get<int>(_keyVoteParameter);
+                    set => Set<int>(_keyVoteParameter, value);
                 }
             }
 
@@ -6224,10 +6764,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // The phase #
+                private static readonly GameEventKey _keyPhase = new("phase");
                 public int Phase 
                 {
-                    get => Get<int>("phase");
-                    set => Set<int>("phase", value);
+                    get => Get<int>(_keyPhase);
+                    set => Set<int>(_keyPhase, value);
                 }
             }
 
@@ -6240,10 +6781,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6256,10 +6798,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6272,10 +6815,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
             }
 
@@ -6288,10 +6832,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
             }
 
@@ -6304,10 +6849,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6320,42 +6866,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // number of active players on both T and CT
+                private static readonly GameEventKey _keyNumplayers = new("numPlayers");
                 public int Numplayers 
                 {
-                    get => Get<int>("numPlayers");
-                    set => Set<int>("numPlayers", value);
+                    get => Get<int>(_keyNumplayers);
+                    set => Set<int>(_keyNumplayers, value);
                 }
 
                 
                 // number of spectators
+                private static readonly GameEventKey _keyNumspectators = new("numSpectators");
                 public int Numspectators 
                 {
-                    get => Get<int>("numSpectators");
-                    set => Set<int>("numSpectators", value);
+                    get => Get<int>(_keyNumspectators);
+                    set => Set<int>(_keyNumspectators, value);
                 }
 
                 
                 // average rank of human players
+                private static readonly GameEventKey _keyAvgRank = new("avg_rank");
                 public int AvgRank 
                 {
-                    get => Get<int>("avg_rank");
-                    set => Set<int>("avg_rank", value);
+                    get => Get<int>(_keyAvgRank);
+                    set => Set<int>(_keyAvgRank, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumtslotsfree = new("numTSlotsFree");
                 public int Numtslotsfree 
                 {
-                    get => Get<int>("numTSlotsFree");
-                    set => Set<int>("numTSlotsFree", value);
+                    get => Get<int>(_keyNumtslotsfree);
+                    set => Set<int>(_keyNumtslotsfree, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyNumctslotsfree = new("numCTSlotsFree");
                 public int Numctslotsfree 
                 {
-                    get => Get<int>("numCTSlotsFree");
-                    set => Set<int>("numCTSlotsFree", value);
+                    get => Get<int>(_keyNumctslotsfree);
+                    set => Set<int>(_keyNumctslotsfree, value);
                 }
             }
 
@@ -6368,42 +6919,47 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public int Entityid 
                 {
-                    get => Get<int>("entityid");
-                    set => Set<int>("entityid", value);
+                    get => Get<int>(_keyEntityid);
+                    set => Set<int>(_keyEntityid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyX = new("x");
                 public float X 
                 {
-                    get => Get<float>("x");
-                    set => Set<float>("x", value);
+                    get => Get<float>(_keyX);
+                    set => Set<float>(_keyX, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyY = new("y");
                 public float Y 
                 {
-                    get => Get<float>("y");
-                    set => Set<float>("y", value);
+                    get => Get<float>(_keyY);
+                    set => Set<float>(_keyY, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyZ = new("z");
                 public float Z 
                 {
-                    get => Get<float>("z");
-                    set => Set<float>("z", value);
+                    get => Get<float>(_keyZ);
+                    set => Set<float>(_keyZ, value);
                 }
             }
 
@@ -6416,18 +6972,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyToteam = new("toteam");
                 public int Toteam 
                 {
-                    get => Get<int>("toteam");
-                    set => Set<int>("toteam", value);
+                    get => Get<int>(_keyToteam);
+                    set => Set<int>(_keyToteam, value);
                 }
             }
 
@@ -6440,18 +6998,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // unique team id
+                private static readonly GameEventKey _keyTeamid = new("teamid");
                 public int Teamid 
                 {
-                    get => Get<int>("teamid");
-                    set => Set<int>("teamid", value);
+                    get => Get<int>(_keyTeamid);
+                    set => Set<int>(_keyTeamid, value);
                 }
 
                 
                 // team name eg "Team Blue"
+                private static readonly GameEventKey _keyTeamname = new("teamname");
                 public string Teamname 
                 {
-                    get => Get<string>("teamname");
-                    set => Set<string>("teamname", value);
+                    get => Get<string>(_keyTeamname);
+                    set => Set<string>(_keyTeamname, value);
                 }
             }
 
@@ -6482,18 +7042,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // unique team id
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // name of the sound to emit
+                private static readonly GameEventKey _keySound = new("sound");
                 public string Sound 
                 {
-                    get => Get<string>("sound");
-                    set => Set<string>("sound", value);
+                    get => Get<string>(_keySound);
+                    set => Set<string>(_keySound, value);
                 }
             }
 
@@ -6506,10 +7068,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // is this a full reset of the map
+                private static readonly GameEventKey _keyFullReset = new("full_reset");
                 public bool FullReset 
                 {
-                    get => Get<bool>("full_reset");
-                    set => Set<bool>("full_reset", value);
+                    get => Get<bool>(_keyFullReset);
+                    set => Set<bool>(_keyFullReset, value);
                 }
             }
 
@@ -6522,18 +7085,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // team id
+                private static readonly GameEventKey _keyTeamid = new("teamid");
                 public int Teamid 
                 {
-                    get => Get<int>("teamid");
-                    set => Set<int>("teamid", value);
+                    get => Get<int>(_keyTeamid);
+                    set => Set<int>(_keyTeamid, value);
                 }
 
                 
                 // total team score
+                private static readonly GameEventKey _keyScore = new("score");
                 public int Score 
                 {
-                    get => Get<int>("score");
-                    set => Set<int>("score", value);
+                    get => Get<int>(_keyScore);
+                    set => Set<int>(_keyScore, value);
                 }
             }
 
@@ -6546,26 +7111,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyDefindex = new("defindex");
                 public long Defindex 
                 {
-                    get => Get<long>("defindex");
-                    set => Set<long>("defindex", value);
+                    get => Get<long>(_keyDefindex);
+                    set => Set<long>(_keyDefindex, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTotalrewards = new("totalrewards");
                 public long Totalrewards 
                 {
-                    get => Get<long>("totalrewards");
-                    set => Set<long>("totalrewards", value);
+                    get => Get<long>(_keyTotalrewards);
+                    set => Set<long>(_keyTotalrewards, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyAccountid = new("accountid");
                 public long Accountid 
                 {
-                    get => Get<long>("accountid");
-                    set => Set<long>("accountid", value);
+                    get => Get<long>(_keyAccountid);
+                    set => Set<long>(_keyAccountid, value);
                 }
             }
 
@@ -6587,10 +7155,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player whose time has expired
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6603,10 +7172,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyTime = new("time");
                 public long Time 
                 {
-                    get => Get<long>("time");
-                    set => Set<long>("time", value);
+                    get => Get<long>(_keyTime);
+                    set => Set<long>(_keyTime, value);
                 }
             }
 
@@ -6619,10 +7189,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyComplete = new("complete");
                 public int Complete 
                 {
-                    get => Get<int>("complete");
-                    set => Set<int>("complete", value);
+                    get => Get<int>(_keyComplete);
+                    set => Set<int>(_keyComplete, value);
                 }
             }
 
@@ -6635,10 +7206,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // user ID of the player banged
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6669,10 +7241,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // id of this specific content (may be image or map)
+                private static readonly GameEventKey _keyHcontent = new("hcontent");
                 public ulong Hcontent 
                 {
-                    get => Get<ulong>("hcontent");
-                    set => Set<ulong>("hcontent", value);
+                    get => Get<ulong>(_keyHcontent);
+                    set => Set<ulong>(_keyHcontent, value);
                 }
             }
 
@@ -6685,18 +7258,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // id of this specific content (may be image or map)
+                private static readonly GameEventKey _keyHcontent = new("hcontent");
                 public ulong Hcontent 
                 {
-                    get => Get<ulong>("hcontent");
-                    set => Set<ulong>("hcontent", value);
+                    get => Get<ulong>(_keyHcontent);
+                    set => Set<ulong>(_keyHcontent, value);
                 }
 
                 
                 // id of the associated content package
+                private static readonly GameEventKey _keyPublishedFileId = new("published_file_id");
                 public ulong PublishedFileId 
                 {
-                    get => Get<ulong>("published_file_id");
-                    set => Set<ulong>("published_file_id", value);
+                    get => Get<ulong>(_keyPublishedFileId);
+                    set => Set<ulong>(_keyPublishedFileId, value);
                 }
             }
 
@@ -6709,18 +7284,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyPublishedFileId = new("published_file_id");
                 public ulong PublishedFileId 
                 {
-                    get => Get<ulong>("published_file_id");
-                    set => Set<ulong>("published_file_id", value);
+                    get => Get<ulong>(_keyPublishedFileId);
+                    set => Set<ulong>(_keyPublishedFileId, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyErrorCode = new("error_code");
                 public long ErrorCode 
                 {
-                    get => Get<long>("error_code");
-                    set => Set<long>("error_code", value);
+                    get => Get<long>(_keyErrorCode);
+                    set => Set<long>(_keyErrorCode, value);
                 }
             }
 
@@ -6733,10 +7310,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyPublishedFileId = new("published_file_id");
                 public ulong PublishedFileId 
                 {
-                    get => Get<ulong>("published_file_id");
-                    set => Set<ulong>("published_file_id", value);
+                    get => Get<ulong>(_keyPublishedFileId);
+                    set => Set<ulong>(_keyPublishedFileId, value);
                 }
             }
 
@@ -6749,10 +7327,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyPublishedFileId = new("published_file_id");
                 public ulong PublishedFileId 
                 {
-                    get => Get<ulong>("published_file_id");
-                    set => Set<ulong>("published_file_id", value);
+                    get => Get<ulong>(_keyPublishedFileId);
+                    set => Set<ulong>(_keyPublishedFileId, value);
                 }
             }
 
@@ -6783,10 +7362,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who was the VIP
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6799,18 +7379,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // player who was the VIP
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // user ID who killed the VIP
+                private static readonly GameEventKey _keyAttacker = new("attacker");
                 public CCSPlayerController Attacker 
                 {
-                    get => Get<CCSPlayerController>("attacker");
-                    set => Set<CCSPlayerController>("attacker", value);
+                    get => Get<CCSPlayerController>(_keyAttacker);
+                    set => Set<CCSPlayerController>(_keyAttacker, value);
                 }
             }
 
@@ -6823,26 +7405,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // which option the player voted on
+                private static readonly GameEventKey _keyVoteOption = new("vote_option");
                 public int VoteOption 
                 {
-                    get => Get<int>("vote_option");
-                    set => Set<int>("vote_option", value);
+                    get => Get<int>(_keyVoteOption);
+                    set => Set<int>(_keyVoteOption, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // player who voted
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -6855,18 +7440,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // entity id of the voter
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public long Entityid 
                 {
-                    get => Get<long>("entityid");
-                    set => Set<long>("entityid", value);
+                    get => Get<long>(_keyEntityid);
+                    set => Set<long>(_keyEntityid, value);
                 }
             }
 
@@ -6879,18 +7466,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // entity id of the voter
+                private static readonly GameEventKey _keyEntityid = new("entityid");
                 public long Entityid 
                 {
-                    get => Get<long>("entityid");
-                    set => Set<long>("entityid", value);
+                    get => Get<long>(_keyEntityid);
+                    set => Set<long>(_keyEntityid, value);
                 }
             }
 
@@ -6903,50 +7492,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyVoteOption1 = new("vote_option1");
                 public int VoteOption1 
                 {
-                    get => Get<int>("vote_option1");
-                    set => Set<int>("vote_option1", value);
+                    get => Get<int>(_keyVoteOption1);
+                    set => Set<int>(_keyVoteOption1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVoteOption2 = new("vote_option2");
                 public int VoteOption2 
                 {
-                    get => Get<int>("vote_option2");
-                    set => Set<int>("vote_option2", value);
+                    get => Get<int>(_keyVoteOption2);
+                    set => Set<int>(_keyVoteOption2, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVoteOption3 = new("vote_option3");
                 public int VoteOption3 
                 {
-                    get => Get<int>("vote_option3");
-                    set => Set<int>("vote_option3", value);
+                    get => Get<int>(_keyVoteOption3);
+                    set => Set<int>(_keyVoteOption3, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVoteOption4 = new("vote_option4");
                 public int VoteOption4 
                 {
-                    get => Get<int>("vote_option4");
-                    set => Set<int>("vote_option4", value);
+                    get => Get<int>(_keyVoteOption4);
+                    set => Set<int>(_keyVoteOption4, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyVoteOption5 = new("vote_option5");
                 public int VoteOption5 
                 {
-                    get => Get<int>("vote_option5");
-                    set => Set<int>("vote_option5", value);
+                    get => Get<int>(_keyVoteOption5);
+                    set => Set<int>(_keyVoteOption5, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyPotentialvotes = new("potentialVotes");
                 public int Potentialvotes 
                 {
-                    get => Get<int>("potentialVotes");
-                    set => Set<int>("potentialVotes", value);
+                    get => Get<int>(_keyPotentialvotes);
+                    set => Set<int>(_keyPotentialvotes, value);
                 }
             }
 
@@ -6968,18 +7563,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // this event is reliable
+                private static readonly GameEventKey _keyReliable = new("reliable");
                 public int Reliable 
                 {
-                    get => Get<int>("reliable");
-                    set => Set<int>("reliable", value);
+                    get => Get<int>(_keyReliable);
+                    set => Set<int>(_keyReliable, value);
                 }
             }
 
@@ -6992,50 +7589,56 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Number of options - up to MAX_VOTE_OPTIONS
+                private static readonly GameEventKey _keyCount = new("count");
                 public int Count 
                 {
-                    get => Get<int>("count");
-                    set => Set<int>("count", value);
+                    get => Get<int>(_keyCount);
+                    set => Set<int>(_keyCount, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOption1 = new("option1");
                 public string Option1 
                 {
-                    get => Get<string>("option1");
-                    set => Set<string>("option1", value);
+                    get => Get<string>(_keyOption1);
+                    set => Set<string>(_keyOption1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOption2 = new("option2");
                 public string Option2 
                 {
-                    get => Get<string>("option2");
-                    set => Set<string>("option2", value);
+                    get => Get<string>(_keyOption2);
+                    set => Set<string>(_keyOption2, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOption3 = new("option3");
                 public string Option3 
                 {
-                    get => Get<string>("option3");
-                    set => Set<string>("option3", value);
+                    get => Get<string>(_keyOption3);
+                    set => Set<string>(_keyOption3, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOption4 = new("option4");
                 public string Option4 
                 {
-                    get => Get<string>("option4");
-                    set => Set<string>("option4", value);
+                    get => Get<string>(_keyOption4);
+                    set => Set<string>(_keyOption4, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyOption5 = new("option5");
                 public string Option5 
                 {
-                    get => Get<string>("option5");
-                    set => Set<string>("option5", value);
+                    get => Get<string>(_keyOption5);
+                    set => Set<string>(_keyOption5, value);
                 }
             }
 
@@ -7048,34 +7651,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyDetails = new("details");
                 public string Details 
                 {
-                    get => Get<string>("details");
-                    set => Set<string>("details", value);
+                    get => Get<string>(_keyDetails);
+                    set => Set<string>(_keyDetails, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyParam1 = new("param1");
                 public string Param1 
                 {
-                    get => Get<string>("param1");
-                    set => Set<string>("param1", value);
+                    get => Get<string>(_keyParam1);
+                    set => Set<string>(_keyParam1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // this event is reliable
+                private static readonly GameEventKey _keyReliable = new("reliable");
                 public int Reliable 
                 {
-                    get => Get<int>("reliable");
-                    set => Set<int>("reliable", value);
+                    get => Get<int>(_keyReliable);
+                    set => Set<int>(_keyReliable, value);
                 }
             }
 
@@ -7088,34 +7695,38 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyIssue = new("issue");
                 public string Issue 
                 {
-                    get => Get<string>("issue");
-                    set => Set<string>("issue", value);
+                    get => Get<string>(_keyIssue);
+                    set => Set<string>(_keyIssue, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyParam1 = new("param1");
                 public string Param1 
                 {
-                    get => Get<string>("param1");
-                    set => Set<string>("param1", value);
+                    get => Get<string>(_keyParam1);
+                    set => Set<string>(_keyParam1, value);
                 }
 
                 
                 
+                private static readonly GameEventKey _keyTeam = new("team");
                 public int Team 
                 {
-                    get => Get<int>("team");
-                    set => Set<int>("team", value);
+                    get => Get<int>(_keyTeam);
+                    set => Set<int>(_keyTeam, value);
                 }
 
                 
                 // entity id of the player who initiated the vote
+                private static readonly GameEventKey _keyInitiator = new("initiator");
                 public long Initiator 
                 {
-                    get => Get<long>("initiator");
-                    set => Set<long>("initiator", value);
+                    get => Get<long>(_keyInitiator);
+                    set => Set<long>(_keyInitiator, value);
                 }
             }
 
@@ -7128,26 +7739,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // weapon name used
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
 
                 
                 // is weapon silenced
+                private static readonly GameEventKey _keySilenced = new("silenced");
                 public bool Silenced 
                 {
-                    get => Get<bool>("silenced");
-                    set => Set<bool>("silenced", value);
+                    get => Get<bool>(_keySilenced);
+                    set => Set<bool>(_keySilenced, value);
                 }
             }
 
@@ -7160,18 +7774,20 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // weapon name used
+                private static readonly GameEventKey _keyWeapon = new("weapon");
                 public string Weapon 
                 {
-                    get => Get<string>("weapon");
-                    set => Set<string>("weapon", value);
+                    get => Get<string>(_keyWeapon);
+                    set => Set<string>(_keyWeapon, value);
                 }
             }
 
@@ -7184,26 +7800,29 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Player who this event applies to
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
 
                 
                 // EWeaponHudSelectionMode (switch / pickup / drop)
+                private static readonly GameEventKey _keyMode = new("mode");
                 public int Mode 
                 {
-                    get => Get<int>("mode");
-                    set => Set<int>("mode", value);
+                    get => Get<int>(_keyMode);
+                    set => Set<int>(_keyMode, value);
                 }
 
                 
                 // Weapon entity index
+                private static readonly GameEventKey _keyEntindex = new("entindex");
                 public long Entindex 
                 {
-                    get => Get<long>("entindex");
-                    set => Set<long>("entindex", value);
+                    get => Get<long>(_keyEntindex);
+                    set => Set<long>(_keyEntindex, value);
                 }
             }
 
@@ -7216,10 +7835,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -7232,10 +7852,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -7248,10 +7869,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -7264,10 +7886,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 
+                private static readonly GameEventKey _keyUserid = new("userid");
                 public CCSPlayerController Userid 
                 {
-                    get => Get<CCSPlayerController>("userid");
-                    set => Set<CCSPlayerController>("userid", value);
+                    get => Get<CCSPlayerController>(_keyUserid);
+                    set => Set<CCSPlayerController>(_keyUserid, value);
                 }
             }
 
@@ -7280,10 +7903,11 @@ namespace CounterStrikeSharp.API.Core
                 
                 
                 // Controller id of user
+                private static readonly GameEventKey _keyControllerid = new("controllerId");
                 public int Controllerid 
                 {
-                    get => Get<int>("controllerId");
-                    set => Set<int>("controllerId", value);
+                    get => Get<int>(_keyControllerid);
+                    set => Set<int>(_keyControllerid, value);
                 }
             }
 
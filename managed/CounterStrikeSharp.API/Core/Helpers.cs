@@ -29,5 +29,13 @@ namespace CounterStrikeSharp.API.Core
         [SecurityCritical]
         [DllImport(dllPath, EntryPoint = "InvokeNative")]
         public static extern void InvokeNative(IntPtr ptr);
+
+        [SecurityCritical]
+        [DllImport(dllPath, EntryPoint = "InvokeNativeBatch")]
+        public static extern void InvokeNativeBatch(IntPtr ptr, int count);
+
+        [SecurityCritical]
+        [DllImport(dllPath, EntryPoint = "ResolveNative")]
+        public static extern ulong ResolveNative(ulong hash);
     }
 }
\ No newline at end of file
@@ -0,0 +1,260 @@
+﻿/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Security;
+using System.Text;
+
+namespace CounterStrikeSharp.API.Core
+{
+    /// <summary>
+    /// Records a sequence of native calls and runs them with a single transition into native code.
+    /// Each record keeps its own arguments, result and error state, so a failing record does not
+    /// affect the others. Arguments are either passed to <see cref="Add"/> directly, which boxes them,
+    /// or pushed one by one onto the last added record with the typed <c>Push</c> overloads, which don't.
+    /// </summary>
+    /// <example>
+    /// <code>
+    /// var getHealth = NativeBatch.Resolve("GET_SCHEMA_VALUE_BY_NAME");
+    /// var batch = new NativeBatch();
+    /// foreach (var pawn in pawns)
+    ///     batch.Add(getHealth).Push(pawn.Handle).Push((int)DataType.DATA_TYPE_INT).Push("CBaseEntity").Push("m_iHealth");
+    /// batch.Invoke();
+    /// var health = batch.GetResult&lt;int&gt;(0);
+    /// </code>
+    /// </example>
+    public class NativeBatch
+    {
+        private const int MaxArguments = 32;
+
+        private fxScriptContext[] _records;
+        private int _count;
+
+        private readonly ScriptContext _marshalContext = new();
+        private readonly List<IntPtr> _strings = new();
+
+        public NativeBatch(int capacity = 16)
+        {
+            _records = new fxScriptContext[Math.Max(capacity, 1)];
+        }
+
+        /// <summary>
+        /// Number of records queued since the last <see cref="Clear"/>.
+        /// </summary>
+        public int Count => _count;
+
+        /// <summary>
+        /// Resolves a native name (e.g. <c>GET_SCHEMA_VALUE_BY_NAME</c>) to an identifier that can be
+        /// passed to <see cref="Add"/>. Resolve once and reuse the identifier.
+        /// </summary>
+        public static ulong Resolve(string nativeName)
+        {
+            uint hash = 5381;
+
+            for (int i = 0; i < nativeName.Length; i++)
+            {
+                hash = ((hash << 5) + hash) ^ nativeName[i];
+            }
+
+            ulong identifier = 0;
+            return ScriptContext.ResolveIdentifier(ref identifier, hash);
+        }
+
+        /// <summary>
+        /// Queues a native call and returns the index of its record. Every argument is boxed, prefer
+        /// <see cref="Add(ulong)"/> and the typed <c>Push</c> overloads on hot paths.
+        /// </summary>
+        [SecuritySafeCritical]
+        public unsafe int Add(ulong nativeIdentifier, params object[] arguments)
+        {
+            var index = AddRecord(nativeIdentifier);
+
+            fixed (fxScriptContext* record = &_records[index])
+            {
+                foreach (var argument in arguments)
+                {
+                    _marshalContext.Push(record, argument);
+                }
+            }
+
+            return index;
+        }
+
+        /// <summary>
+        /// Queues a native call without arguments, push them with the typed <c>Push</c> overloads.
+        /// The record's index is <see cref="Count"/> - 1.
+        /// </summary>
+        public NativeBatch Add(ulong nativeIdentifier)
+        {
+            AddRecord(nativeIdentifier);
+            return this;
+        }
+
+        /// <summary>
+        /// Appends a value of at most 8 bytes, e.g. an int, float, pointer or enum, to the last added record.
+        /// </summary>
+        [SecuritySafeCritical]
+        public unsafe NativeBatch Push<T>(T value) where T : unmanaged
+        {
+            if (sizeof(T) > 8)
+            {
+                throw new ArgumentException($"{typeof(T).Name} does not fit in a native argument.", nameof(value));
+            }
+
+            fixed (fxScriptContext* record = &LastRecord())
+            {
+                var slot = &record->functionData[8 * record->numArguments];
+                *(long*)slot = 0;
+                *(T*)slot = value;
+                record->numArguments++;
+            }
+
+            return this;
+        }
+
+        /// <summary>
+        /// Appends a UTF-8 copy of <paramref name="value"/> to the last added record. The copy is released by
+        /// <see cref="Invoke"/> or <see cref="Clear"/>.
+        /// </summary>
+        [SecuritySafeCritical]
+        public NativeBatch Push(string? value)
+        {
+            var ptr = IntPtr.Zero;
+
+            if (value != null)
+            {
+                var length = Encoding.UTF8.GetByteCount(value);
+                ptr = Marshal.AllocHGlobal(length + 1);
+                _strings.Add(ptr);
+
+                unsafe
+                {
+                    var bytes = (byte*)ptr;
+                    fixed (char* chars = value)
+                    {
+                        Encoding.UTF8.GetBytes(chars, value.Length, bytes, length);
+                    }
+                    bytes[length] = 0;
+                }
+            }
+
+            return Push(ptr);
+        }
+
+        /// <summary>
+        /// Appends the handle of <paramref name="value"/> to the last added record.
+        /// </summary>
+        public NativeBatch Push(NativeObject value)
+        {
+            return Push(value.Handle);
+        }
+
+        private int AddRecord(ulong nativeIdentifier)
+        {
+            if (_count == _records.Length)
+            {
+                Array.Resize(ref _records, _records.Length * 2);
+            }
+
+            var index = _count++;
+            _records[index] = default;
+            _records[index].nativeIdentifier = nativeIdentifier;
+
+            return index;
+        }
+
+        private ref fxScriptContext LastRecord()
+        {
+            if (_count == 0)
+            {
+                throw new InvalidOperationException("Add a record before pushing its arguments.");
+            }
+
+            ref var record = ref _records[_count - 1];
+            if (record.numArguments == MaxArguments)
+            {
+                throw new InvalidOperationException($"A native call takes at most {MaxArguments} arguments.");
+            }
+
+            return ref record;
+        }
+
+        private void ReleaseStrings()
+        {
+            foreach (var ptr in _strings)
+            {
+                Marshal.FreeHGlobal(ptr);
+            }
+
+            _strings.Clear();
+            _marshalContext.GlobalCleanUp();
+        }
+
+        /// <summary>
+        /// Executes every queued record in order with one native transition. String arguments are
+        /// released afterwards, so records with strings have to be queued again before the next call.
+        /// </summary>
+        [SecuritySafeCritical]
+        public unsafe void Invoke()
+        {
+            if (_count == 0) return;
+
+            fixed (fxScriptContext* records = _records)
+            {
+                Helpers.InvokeNativeBatch(new IntPtr(records), _count);
+            }
+
+            ReleaseStrings();
+        }
+
+        public bool HasError(int index)
+        {
+            return _records[index].hasError != 0;
+        }
+
+        /// <summary>
+        /// Throws a <see cref="NativeException"/> if the record at <paramref name="index"/> failed.
+        /// </summary>
+        public void CheckErrors(int index)
+        {
+            if (HasError(index))
+            {
+                throw new NativeException(GetResult<string>(index));
+            }
+        }
+
+        [SecuritySafeCritical]
+        public unsafe T GetResult<T>(int index)
+        {
+            fixed (fxScriptContext* record = &_records[index])
+            {
+                return (T)_marshalContext.GetResult(typeof(T), &record->result[0]);
+            }
+        }
+
+        /// <summary>
+        /// Removes all queued records so the batch can be reused without reallocating, and releases
+        /// string arguments of records that were never invoked.
+        /// </summary>
+        public void Clear()
+        {
+            _count = 0;
+            ReleaseStrings();
+        }
+    }
+}
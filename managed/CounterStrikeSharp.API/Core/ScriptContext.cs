@@ -165,6 +165,23 @@ namespace CounterStrikeSharp.API.Core
 			}
 		}
 
+		/// <summary>
+		/// Resolves a native name hash to its dispatch slot the first time it is used,
+		/// so later invocations skip the native-side hash lookup.
+		/// Falls back to the plain hash if the native is not registered.
+		/// </summary>
+		[SecuritySafeCritical]
+		public static ulong ResolveIdentifier(ref ulong cachedIdentifier, ulong hash)
+		{
+			if (cachedIdentifier == 0)
+			{
+				var resolved = Helpers.ResolveNative(hash);
+				cachedIdentifier = resolved != 0 ? resolved : hash;
+			}
+
+			return cachedIdentifier;
+		}
+
 		public unsafe void CheckErrors()
 		{
 			fixed (fxScriptContext* context = &m_extContext)
@@ -0,0 +1,179 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using CounterStrikeSharp.API.Modules.Memory;
+
+namespace CounterStrikeSharp.API.Modules.Entities
+{
+    /// <summary>
+    /// Reads schema fields of many entities in one native call, one typed column per field.
+    /// Define the columns once and call <see cref="Read"/> with the entity handles to sample.
+    /// </summary>
+    /// <example>
+    /// <code>
+    /// var snapshot = new EntitySnapshot();
+    /// var health = snapshot.AddColumn&lt;int&gt;("CBaseEntity", "m_iHealth");
+    /// var origin = snapshot.AddColumn&lt;float&gt;(3, ("CBaseEntity", "m_CBodyComponent"),
+    ///     ("CBodyComponent", "m_pSceneNode"), ("CGameSceneNode", "m_vecAbsOrigin"));
+    /// snapshot.Read(handles);
+    /// </code>
+    /// </example>
+    public sealed class EntitySnapshot
+    {
+        private readonly List<uint> _fieldPaths = new();
+        private readonly List<int> _widths = new();
+        private readonly List<int> _elementSizes = new();
+        private readonly List<EntitySnapshotColumn> _columns = new();
+        private readonly List<IntPtr> _columnPointers = new();
+        private byte[] _valid = Array.Empty<byte>();
+        private int _capacity;
+
+        /// <summary>
+        /// Number of rows filled by the last <see cref="Read"/>.
+        /// </summary>
+        public int Count { get; private set; }
+
+        /// <summary>
+        /// Adds a column for a field that lives directly on the entity.
+        /// </summary>
+        public EntitySnapshotColumn<T> AddColumn<T>(string className, string propertyName, int width = 1) where T : unmanaged
+        {
+            return AddColumn<T>(width, (className, propertyName));
+        }
+
+        /// <summary>
+        /// Adds a column that follows a chain of fields. Every field but the last must be a pointer and is
+        /// dereferenced; the last one is copied <paramref name="width"/> elements wide, e.g. 3 floats for a vector.
+        /// <typeparamref name="T"/> must have the size of the field's native type, and the column may not be wider
+        /// than the field, otherwise <see cref="Read"/> throws.
+        /// </summary>
+        public EntitySnapshotColumn<T> AddColumn<T>(int width, params (string ClassName, string PropertyName)[] path) where T : unmanaged
+        {
+            if (path.Length == 0) throw new ArgumentException("A snapshot column needs at least one field.", nameof(path));
+            if (width <= 0) throw new ArgumentOutOfRangeException(nameof(width));
+
+            for (var i = 0; i < path.Length - 1; i++)
+            {
+                _fieldPaths.Add(Schema.GetSchemaFieldToken<IntPtr>(path[i].ClassName, path[i].PropertyName));
+            }
+
+            var leaf = path[^1];
+            _fieldPaths.Add(Schema.GetSchemaFieldToken<T>(leaf.ClassName, leaf.PropertyName));
+            _fieldPaths.Add(0);
+            _widths.Add(width);
+            _elementSizes.Add(Unsafe.SizeOf<T>());
+
+            var column = new EntitySnapshotColumn<T>(width);
+            _columns.Add(column);
+            _columnPointers.Add(column.Allocate(_capacity));
+
+            return column;
+        }
+
+        /// <summary>
+        /// Whether row <paramref name="row"/> of the last read resolved to a live entity with every pointer in its paths set.
+        /// </summary>
+        public bool IsValid(int row) => _valid[row] != 0;
+
+        /// <summary>
+        /// Samples every column for the given raw entity handles. Row <c>i</c> of each column belongs to <c>handles[i]</c>.
+        /// </summary>
+        /// <returns>The number of valid rows.</returns>
+        public unsafe int Read(ReadOnlySpan<uint> handles)
+        {
+            EnsureCapacity(handles.Length);
+            Count = handles.Length;
+
+            var fieldPaths = CollectionsMarshal.AsSpan(_fieldPaths);
+            var widths = CollectionsMarshal.AsSpan(_widths);
+            var elementSizes = CollectionsMarshal.AsSpan(_elementSizes);
+            var columnPointers = CollectionsMarshal.AsSpan(_columnPointers);
+
+            fixed (uint* pHandles = handles)
+            fixed (uint* pFieldPaths = fieldPaths)
+            fixed (int* pWidths = widths)
+            fixed (int* pElementSizes = elementSizes)
+            fixed (IntPtr* pColumns = columnPointers)
+            fixed (byte* pValid = _valid)
+            {
+                return NativeAPI.SnapshotEntityFields((IntPtr)pHandles, handles.Length, (IntPtr)pFieldPaths, (IntPtr)pWidths,
+                    (IntPtr)pElementSizes, (IntPtr)pColumns, _columns.Count, (IntPtr)pValid);
+            }
+        }
+
+        private void EnsureCapacity(int rows)
+        {
+            if (rows <= _capacity) return;
+
+            _capacity = Math.Max(rows, Math.Max(_capacity * 2, 16));
+            _valid = new byte[_capacity];
+
+            for (var i = 0; i < _columns.Count; i++)
+            {
+                _columnPointers[i] = _columns[i].Allocate(_capacity);
+            }
+        }
+    }
+
+    public abstract class EntitySnapshotColumn
+    {
+        internal abstract IntPtr Allocate(int rows);
+    }
+
+    /// <summary>
+    /// Contiguous values of one field across the rows of an <see cref="EntitySnapshot"/>.
+    /// </summary>
+    public sealed class EntitySnapshotColumn<T> : EntitySnapshotColumn where T : unmanaged
+    {
+        private T[] _values = Array.Empty<T>();
+
+        /// <summary>
+        /// Number of elements stored per row.
+        /// </summary>
+        public int Width { get; }
+
+        internal EntitySnapshotColumn(int width)
+        {
+            Width = width;
+        }
+
+        /// <summary>
+        /// All elements of row <paramref name="row"/>.
+        /// </summary>
+        public ReadOnlySpan<T> this[int row] => new(_values, row * Width, Width);
+
+        /// <summary>
+        /// First element of row <paramref name="row"/>, the whole value for single width columns.
+        /// </summary>
+        public T Get(int row) => _values[row * Width];
+
+        /// <summary>
+        /// The raw column, <see cref="Width"/> elements per row. Rows past the last read's count are stale.
+        /// </summary>
+        public ReadOnlySpan<T> Values => _values;
+
+        internal override IntPtr Allocate(int rows)
+        {
+            // Pinned so the native side can be handed a stable pointer once per resize.
+            _values = GC.AllocateArray<T>(rows * Width, pinned: true);
+            return rows == 0 ? IntPtr.Zero : Marshal.UnsafeAddrOfPinnedArrayElement(_values, 0);
+        }
+    }
+}
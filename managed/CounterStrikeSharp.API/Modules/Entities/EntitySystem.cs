@@ -67,6 +67,74 @@ public static class EntitySystem
         return Marshal.ReadIntPtr(pIdentityPtr);
     }
 
+    /// <summary>
+    /// Returns the raw handles of all live entities whose designer name equals <paramref name="designerName"/>,
+    /// or contains it when <paramref name="exact"/> is false. Served by the native designer name index.
+    /// </summary>
+    public static uint[] GetEntityHandlesByDesignerName(string designerName, bool exact = true)
+    {
+        return ReadHandles((handles, capacity) =>
+            NativeAPI.GetEntitiesByDesignerName(designerName, exact, handles, capacity));
+    }
+
+    /// <summary>
+    /// Returns the raw handles of entities whose origin lies within <paramref name="radius"/> of <paramref name="origin"/>.
+    /// An empty <paramref name="designerName"/> matches every entity, otherwise only that exact designer name.
+    /// </summary>
+    public static uint[] FindEntityHandlesInRadius(Vector origin, float radius, string designerName = "")
+    {
+        return ReadHandles((handles, capacity) =>
+            NativeAPI.FindEntitiesInRadius(origin.Handle, radius, designerName, handles, capacity));
+    }
+
+    /// <summary>
+    /// Returns the raw handles of entities whose origin lies inside the box spanned by <paramref name="mins"/> and <paramref name="maxs"/>.
+    /// </summary>
+    public static uint[] FindEntityHandlesInBox(Vector mins, Vector maxs, string designerName = "")
+    {
+        return ReadHandles((handles, capacity) =>
+            NativeAPI.FindEntitiesInBox(mins.Handle, maxs.Handle, designerName, handles, capacity));
+    }
+
+    /// <summary>
+    /// Returns the raw handles of up to <paramref name="count"/> entities closest to <paramref name="origin"/>, nearest first.
+    /// </summary>
+    public static unsafe uint[] FindNearestEntityHandles(Vector origin, int count, float maxRadius = float.MaxValue,
+        string designerName = "")
+    {
+        var handles = new uint[Math.Max(count, 0)];
+        fixed (uint* pHandles = handles)
+        {
+            count = NativeAPI.FindNearestEntities(origin.Handle, maxRadius, designerName, (IntPtr)pHandles, handles.Length);
+        }
+
+        Array.Resize(ref handles, count);
+        return handles;
+    }
+
+    // The handle natives write up to `capacity` handles and return the total, retry once if it did not fit.
+    private static unsafe uint[] ReadHandles(Func<IntPtr, int, int> read)
+    {
+        var handles = new uint[64];
+
+        while (true)
+        {
+            int count;
+            fixed (uint* pHandles = handles)
+            {
+                count = read((IntPtr)pHandles, handles.Length);
+            }
+
+            if (count <= handles.Length)
+            {
+                Array.Resize(ref handles, count);
+                return handles;
+            }
+
+            handles = new uint[count];
+        }
+    }
+
     public static uint GetRawHandleFromEntityPointer(IntPtr pointer)
     {
         if (pointer == IntPtr.Zero)
@@ -36,12 +36,22 @@ namespace CounterStrikeSharp.API.Modules.Events
         {
         }
         
+        /// <summary>
+        /// Creates a new game event. The event is only valid for the current server frame: fire it
+        /// before the frame ends, otherwise it is freed and the handle must not be used again.
+        /// </summary>
         public GameEvent(string name, bool force) : this(NativeAPI.CreateEvent(name, force))
         {
         }
         
         public string EventName => NativeAPI.GetEventName(Handle);
 
+        /// <summary>
+        /// Number of events created through <see cref="GameEvent(string, bool)"/> that have not been fired yet.
+        /// Unfired events are freed at the end of the server frame they were created in.
+        /// </summary>
+        public static int LiveEventCount => NativeAPI.GetLiveEventCount();
+
         public T Get<T>(string name)
         {
             var type = typeof(T);
@@ -95,6 +105,79 @@ namespace CounterStrikeSharp.API.Modules.Events
             }
         }
 
+        public T Get<T>(GameEventKey key)
+        {
+            var type = typeof(T);
+            object result = type switch
+            {
+                _ when type == typeof(float) => NativeAPI.GetEventFloatBySymbol(Handle, key.Symbol),
+                _ when type == typeof(short) => NativeAPI.GetEventIntBySymbol(Handle, key.Symbol),
+                _ when type == typeof(int) => NativeAPI.GetEventIntBySymbol(Handle, key.Symbol),
+                _ when type == typeof(string) => NativeAPI.GetEventStringBySymbol(Handle, key.Symbol),
+                _ when type == typeof(bool) => NativeAPI.GetEventBoolBySymbol(Handle, key.Symbol),
+                _ when type == typeof(ulong) => NativeAPI.GetEventUint64BySymbol(Handle, key.Symbol),
+                _ when type == typeof(long) => (long)NativeAPI.GetEventUint64BySymbol(Handle, key.Symbol),
+                _ when type == typeof(CCSPlayerController) => new CCSPlayerController(NativeAPI.GetEventPlayerControllerBySymbol(Handle, key.Symbol)),
+                _ => throw new NotSupportedException(),
+            };
+
+            return (T)result;
+        }
+
+        public void Set<T>(GameEventKey key, T value)
+        {
+            var type = typeof(T);
+            switch (type)
+            {
+                case var _ when value is float f:
+                    NativeAPI.SetEventFloatBySymbol(Handle, key.Symbol, f);
+                    break;
+                case var _ when value is short s:
+                    NativeAPI.SetEventIntBySymbol(Handle, key.Symbol, s);
+                    break;
+                case var _ when value is int i:
+                    NativeAPI.SetEventIntBySymbol(Handle, key.Symbol, i);
+                    break;
+                case var _ when value is CCSPlayerController player:
+                    NativeAPI.SetEventPlayerControllerBySymbol(Handle, key.Symbol, player.Handle);
+                    break;
+                case var _ when value is string s:
+                    NativeAPI.SetEventStringBySymbol(Handle, key.Symbol, s);
+                    break;
+                case var _ when value is bool b:
+                    NativeAPI.SetEventBoolBySymbol(Handle, key.Symbol, b);
+                    break;
+                case var _ when value is ulong ul:
+                    NativeAPI.SetEventUint64BySymbol(Handle, key.Symbol, ul);
+                    break;
+                case var _ when value is long l:
+                    NativeAPI.SetEventUint64BySymbol(Handle, key.Symbol, (ulong)l);
+                    break;
+                default:
+                    throw new NotSupportedException();
+            }
+        }
+
+        /// <summary>
+        /// Reads several keys of this event with a single native call. Every value is written to its own
+        /// 8 byte slot of <paramref name="values"/>: bools, ints and floats in the low bytes, strings,
+        /// controllers and pawns as pointers that are only valid while the event is alive.
+        /// </summary>
+        public unsafe void ReadFields(ReadOnlySpan<int> symbols, ReadOnlySpan<GameEventKeyType> types, Span<ulong> values)
+        {
+            if (types.Length != symbols.Length || values.Length < symbols.Length)
+            {
+                throw new ArgumentException("Symbol, type and value spans must have matching lengths.");
+            }
+
+            fixed (int* pSymbols = symbols)
+            fixed (GameEventKeyType* pTypes = types)
+            fixed (ulong* pValues = values)
+            {
+                NativeAPI.ReadEventFields(Handle, (IntPtr)pSymbols, (IntPtr)pTypes, symbols.Length, (IntPtr)pValues);
+            }
+        }
+
         protected bool GetBool(string name) => NativeAPI.GetEventBool(Handle, name);
         protected float GetFloat(string name) => NativeAPI.GetEventFloat(Handle, name);
         protected string GetString(string name) => NativeAPI.GetEventString(Handle, name);
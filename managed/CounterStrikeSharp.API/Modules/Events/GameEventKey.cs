@@ -0,0 +1,67 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+
+using System;
+using CounterStrikeSharp.API.Core;
+
+namespace CounterStrikeSharp.API.Modules.Events
+{
+    /// <summary>
+    /// Value kinds understood by <see cref="GameEvent.ReadFields"/>.
+    /// </summary>
+    public enum GameEventKeyType
+    {
+        Bool = 0,
+        Int,
+        Float,
+        String,
+        Uint64,
+        PlayerController,
+        PlayerPawn
+    }
+
+    /// <summary>
+    /// A game event key name interned on the native side. The symbol is resolved on first use and
+    /// reused for every read or write afterwards, so the key name is only hashed once.
+    /// </summary>
+    public sealed class GameEventKey
+    {
+        private int _symbol;
+
+        public GameEventKey(string name)
+        {
+            Name = name;
+        }
+
+        public string Name { get; }
+
+        public int Symbol
+        {
+            get
+            {
+                if (_symbol == 0)
+                {
+                    _symbol = NativeAPI.GetEventKeySymbol(Name);
+                }
+
+                return _symbol;
+            }
+        }
+
+        public override string ToString() => Name;
+    }
+}
@@ -11,6 +11,8 @@ public class Schema
 {
     private static Dictionary<Tuple<string, string>, short> _schemaOffsets = new();
 
+    private static Dictionary<Tuple<string, string, DataType>, uint> _schemaFieldTokens = new();
+
     private static HashSet<string> _cs2BadList = new HashSet<string>()
     {
         "m_bIsValveDS",
@@ -75,9 +77,37 @@ public class Schema
         return NativeAPI.IsSchemaFieldNetworked(className, propertyName);
     }
 
+    /// <summary>
+    /// Resolves a field token for the given class, member and value type.
+    /// Tokens are cached, so the class and member names only cross into native code once.
+    /// </summary>
+    public static uint GetSchemaFieldToken<T>(string className, string propertyName)
+    {
+        var dataType = typeof(T).ToDataType() ?? throw new NotSupportedException($"Type {typeof(T)} is not a supported schema value type.");
+
+        var key = new Tuple<string, string, DataType>(className, propertyName, dataType);
+        if (!_schemaFieldTokens.TryGetValue(key, out var token))
+        {
+            token = NativeAPI.GetSchemaFieldToken(className, propertyName, (int)dataType);
+            _schemaFieldTokens.Add(key, token);
+        }
+
+        return token;
+    }
+
+    public static T GetSchemaValue<T>(IntPtr handle, uint token)
+    {
+        return NativeAPI.GetSchemaValueByToken<T>(handle, token);
+    }
+
+    public static void SetSchemaValue<T>(IntPtr handle, uint token, T value)
+    {
+        NativeAPI.SetSchemaValueByToken(handle, token, value);
+    }
+
     public static T GetSchemaValue<T>(IntPtr handle, string className, string propertyName)
     {
-        return NativeAPI.GetSchemaValueByName<T>(handle, (int)typeof(T).ToDataType(), className, propertyName);
+        return GetSchemaValue<T>(handle, GetSchemaFieldToken<T>(className, propertyName));
     }
 
     public static void SetSchemaValue<T>(IntPtr handle, string className, string propertyName, T value)
@@ -87,9 +117,34 @@ public class Schema
             throw new Exception($"Cannot set or get '{className}::{propertyName}' with \"FollowCS2ServerGuidelines\" option enabled.");
         }
 
-        NativeAPI.SetSchemaValueByName<T>(handle, (int)typeof(T).ToDataType(), className, propertyName, value);
+        SetSchemaValue(handle, GetSchemaFieldToken<T>(className, propertyName), value);
     }
 
+    /// <summary>
+    /// Writes a schema value and, if the field is networked, marks it as changed for network transmission
+    /// in the same native call. Notifications are buffered and sent once per field at the end of the frame.
+    /// </summary>
+    public static void SetSchemaValueAndNotify<T>(IntPtr handle, string className, string propertyName, T value)
+    {
+        if (CoreConfig.FollowCS2ServerGuidelines && _cs2BadList.Contains(propertyName))
+        {
+            throw new Exception($"Cannot set or get '{className}::{propertyName}' with \"FollowCS2ServerGuidelines\" option enabled.");
+        }
+
+        NativeAPI.SetSchemaValueAndNotify(handle, GetSchemaFieldToken<T>(className, propertyName), value);
+    }
+
+    /// <summary>
+    /// Number of network state change notifications requested since the server started.
+    /// </summary>
+    public static ulong StateChangesRequested => NativeAPI.GetStateChangesRequested();
+
+    /// <summary>
+    /// Number of requested state change notifications that were never sent to the engine,
+    /// because the same field was already pending that frame or its entity was deleted.
+    /// </summary>
+    public static ulong StateChangesSaved => NativeAPI.GetStateChangesSaved();
+
     public static T GetDeclaredClass<T>(IntPtr pointer, string className, string memberName)
     {
         return (T)Activator.CreateInstance(typeof(T), pointer + GetSchemaOffset(className, memberName));
@@ -34,6 +34,20 @@ namespace CounterStrikeSharp.API.Modules.Timers
             Handle = NativeAPI.CreateTimer(interval, callback, (int)(flags ?? 0));
         }
 
+        protected Timer(IntPtr handle) : base(handle)
+        {
+        }
+
+        /// <summary>
+        /// Creates a timer that fires on a server tick boundary, <paramref name="ticks"/> ticks from now.
+        /// Pass <see cref="TimerFlags.REPEAT"/> to fire every <paramref name="ticks"/> ticks.
+        /// Tick timers are evaluated natively on every server frame instead of the 0.1s timer think.
+        /// </summary>
+        public static Timer FromTicks(int ticks, Action callback, TimerFlags? flags = null)
+        {
+            return new Timer(NativeAPI.CreateTickTimer(ticks, callback, (int)(flags ?? 0)));
+        }
+
         public void Kill()
         {
             NativeAPI.KillTimer(Handle);
@@ -114,11 +114,11 @@ namespace CounterStrikeSharp.API
 
         public static IEnumerable<T> FindAllEntitiesByDesignerName<T>(string designerName) where T : CEntityInstance
         {
-            var pEntity = new CEntityIdentity(EntitySystem.FirstActiveEntity);
-            for (; pEntity != null && pEntity.Handle != IntPtr.Zero; pEntity = pEntity.Next)
+            foreach (var handle in EntitySystem.GetEntityHandlesByDesignerName(designerName, false))
             {
-                if (pEntity.DesignerName == null || !pEntity.DesignerName.Contains(designerName)) continue;
-                yield return new PointerTo<T>(pEntity.Handle).Value;
+                var pEntity = EntitySystem.GetEntityByHandle(handle);
+                if (pEntity == null) continue;
+                yield return (T)Activator.CreateInstance(typeof(T), pEntity.Value)!;
             }
         }
         
@@ -198,8 +198,6 @@ namespace CounterStrikeSharp.API
 
             return (T)Activator.CreateInstance(typeof(T), pointerTo)!;
         }
-        
-        private static int FindSchemaChain(string className) => Schema.GetSchemaOffset(className, "__m_pChainEntity");
 
         /// <summary>
         /// Marks a field as changed for network transmission.
@@ -211,25 +209,10 @@ namespace CounterStrikeSharp.API
         /// <param name="extraOffset">Any additional offset to the schema field</param>
         public static void SetStateChanged(CBaseEntity entity, string className, string fieldName, int extraOffset = 0)
         {
-            if (!Schema.IsSchemaFieldNetworked(className, fieldName))
+            if (!NativeAPI.SetStateChanged(entity.Handle, className, fieldName, extraOffset))
             {
                 Application.Instance.Logger.LogWarning("Field {ClassName}:{FieldName} is not networked, but SetStateChanged was called on it.", className, fieldName);
-                return;
             }
-            
-            int offset = Schema.GetSchemaOffset(className, fieldName);
-            int chainOffset = FindSchemaChain(className);
-
-            if (chainOffset != 0)
-            {
-                VirtualFunctions.NetworkStateChanged(entity.Handle + chainOffset, offset + extraOffset, 0xFFFFFFFF);
-                return;
-            }
-
-            VirtualFunctions.StateChanged(entity.NetworkTransmitComponent.Handle, entity.Handle, offset + extraOffset, -1, -1);
-
-            entity.LastNetworkChange = Server.CurrentTime;
-            entity.IsSteadyState.Clear();
         }
     }
 }
\ No newline at end of file
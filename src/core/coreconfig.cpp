@@ -52,6 +52,7 @@ bool CCoreConfig::Init(char* conf_error, int conf_error_size)
         FollowCS2ServerGuidelines = m_json.value("FollowCS2ServerGuidelines", FollowCS2ServerGuidelines);
         PluginHotReloadEnabled = m_json.value("PluginHotReloadEnabled", PluginHotReloadEnabled);
         ServerLanguage = m_json.value("ServerLanguage", ServerLanguage);
+        WarmSchemaCacheOnStartup = m_json.value("WarmSchemaCacheOnStartup", WarmSchemaCacheOnStartup);
     } catch (const std::exception& ex) {
         V_snprintf(conf_error, conf_error_size, "Failed to parse CoreConfig file: %s", ex.what());
         return false;
@@ -30,6 +30,7 @@ class CCoreConfig
     bool FollowCS2ServerGuidelines = true;
     bool PluginHotReloadEnabled = true;
     std::string ServerLanguage = "en";
+    bool WarmSchemaCacheOnStartup = false;
 
     using json = nlohmann::json;
     CCoreConfig(const std::string& path);
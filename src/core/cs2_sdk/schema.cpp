@@ -19,19 +19,30 @@
 
 #include "schema.h"
 
+#include <public/eiface.h>
+
 #include "interfaces/cs2_interfaces.h"
 #include "core/globals.h"
 #include "core/memory.h"
 #include "core/log.h"
+#include "core/coreconfig.h"
+#include "core/gameconfig.h"
+#include "core/function.h"
+#include "scripting/script_engine.h"
 
-#include "tier1/utlmap.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_set>
 
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
 
-using SchemaKeyValueMap_t = CUtlMap<uint32_t, SchemaKey>;
-using SchemaTableMap_t = CUtlMap<uint32_t, SchemaKeyValueMap_t*>;
-
 bool IsFieldNetworked(SchemaClassFieldData_t& field) {
     for (int i = 0; i < field.m_metadata_size; i++) {
         static auto networkEnabled = hash_32_fnv1a_const("MNetworkEnable");
@@ -41,60 +52,213 @@ bool IsFieldNetworked(SchemaClassFieldData_t& field) {
     return false;
 }
 
-static bool InitSchemaFieldsForClass(SchemaTableMap_t* tableMap,
-                                     const char* className,
-                                     uint32_t classKey) {
-    CSchemaSystemTypeScope* pType =
-        counterstrikesharp::interfaces::pSchemaSystem->FindTypeScopeForModule(MODULE_PREFIX "server" MODULE_EXT);
+namespace {
 
-    if (!pType) return false;
+inline uint64_t MakeOffsetKey(uint32_t classKey, uint32_t memberKey) {
+    return (static_cast<uint64_t>(classKey) << 32) | memberKey;
+}
 
-    SchemaClassInfoData_t* pClassInfo = pType->FindDeclaredClass(className);
+// Member key of the per-class record, published once a class has been flattened into the
+// cache. Its offset is the class's chain entity offset, 0 when it has none. No schema member
+// has an empty name, so it can't shadow a real field.
+const uint32_t kClassRecordMember = hash_32_fnv1a_const("");
 
-    if (!pClassInfo) {
-        SchemaKeyValueMap_t* map = new SchemaKeyValueMap_t(0, 0, DefLessFunc(uint32_t));
-        tableMap->Insert(classKey, map);
+/**
+ * Open addressing (linear probe) table of (classKey << 32 | memberKey) -> SchemaKey.
+ * Readers never lock: an entry's value is written before its key is published with
+ * release semantics, and growing builds a new table which is swapped in atomically.
+ * Old tables are retired rather than freed so in-flight readers stay valid.
+ * All writers must hold m_writeLock.
+ */
+class SchemaOffsetCache {
+  public:
+    SchemaOffsetCache() { m_table.store(NewTable(kInitialCapacityLog2), std::memory_order_release); }
 
-        Warning("InitSchemaFieldsForClass(): '%s' was not found!\n", className);
-        return false;
+    bool Find(uint64_t key, SchemaKey& out) const {
+        const Table* table = m_table.load(std::memory_order_acquire);
+
+        for (size_t i = Slot(table, key);; i = (i + 1) & table->mask) {
+            const Entry& entry = table->entries[i];
+            uint64_t entryKey = entry.key.load(std::memory_order_acquire);
+
+            if (entryKey == key) {
+                out = entry.value;
+                return true;
+            }
+
+            if (entryKey == kEmptyKey) return false;
+        }
+    }
+
+    // Caller must hold m_writeLock.
+    void Insert(uint64_t key, SchemaKey value) {
+        if (key == kEmptyKey) return;
+
+        Table* table = m_table.load(std::memory_order_relaxed);
+        if ((m_count + 1) * 2 > table->mask + 1) {
+            table = Grow(table);
+        }
+
+        if (InsertInto(table, key, value)) m_count++;
     }
 
-    short fieldsSize = pClassInfo->m_align;
-    SchemaClassFieldData_t* pFields = pClassInfo->m_fields;
+    std::mutex m_writeLock;
+    std::unordered_set<uint32_t> m_indexedClasses;
+    std::unordered_set<uint32_t> m_missingClasses;
+
+  private:
+    static constexpr uint64_t kEmptyKey = 0;
+    static constexpr int kInitialCapacityLog2 = 12;
 
-    SchemaKeyValueMap_t* keyValueMap = new SchemaKeyValueMap_t(0, 0, DefLessFunc(uint32_t));
-    keyValueMap->EnsureCapacity(fieldsSize);
-    tableMap->Insert(classKey, keyValueMap);
+    struct Entry {
+        std::atomic<uint64_t> key;
+        SchemaKey value;
+    };
 
-    for (int i = 0; i < fieldsSize; ++i) {
-        SchemaClassFieldData_t& field = pFields[i];
+    struct Table {
+        size_t mask;
+        int shift;
+        std::unique_ptr<Entry[]> entries;
+    };
 
-        keyValueMap->Insert(hash_32_fnv1a_const(field.m_name),
-                            {field.m_single_inheritance_offset, IsFieldNetworked(field)});
+    static Table* NewTable(int capacityLog2) {
+        auto* table = new Table;
+        table->mask = (size_t(1) << capacityLog2) - 1;
+        table->shift = 64 - capacityLog2;
+        table->entries.reset(new Entry[table->mask + 1]());
+        return table;
     }
 
-    return true;
+    static size_t Slot(const Table* table, uint64_t key) {
+        // Fibonacci hashing spreads the class half of the key across the whole table.
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> table->shift);
+    }
+
+    static bool InsertInto(Table* table, uint64_t key, SchemaKey value) {
+        for (size_t i = Slot(table, key);; i = (i + 1) & table->mask) {
+            Entry& entry = table->entries[i];
+            uint64_t entryKey = entry.key.load(std::memory_order_relaxed);
+
+            if (entryKey == key) return false;
+
+            if (entryKey == kEmptyKey) {
+                entry.value = value;
+                entry.key.store(key, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    Table* Grow(Table* table) {
+        Table* grown = NewTable(64 - table->shift + 1);
+
+        for (size_t i = 0; i <= table->mask; ++i) {
+            const Entry& entry = table->entries[i];
+            uint64_t entryKey = entry.key.load(std::memory_order_relaxed);
+            if (entryKey != kEmptyKey) InsertInto(grown, entryKey, entry.value);
+        }
+
+        m_table.store(grown, std::memory_order_release);
+        m_retired.emplace_back(table);
+
+        return grown;
+    }
+
+    std::atomic<Table*> m_table;
+    std::vector<std::unique_ptr<Table>> m_retired;
+    size_t m_count = 0;
+};
+
+SchemaOffsetCache& OffsetCache() {
+    static SchemaOffsetCache cache;
+    return cache;
 }
 
-int16_t schema::FindChainOffset(const char* className) {
+}  // namespace
+
+// Caller must hold the offset cache write lock.
+static bool InitSchemaFieldsForClass(SchemaOffsetCache& cache, const char* className, uint32_t classKey) {
+    if (cache.m_indexedClasses.count(classKey)) return true;
+
     CSchemaSystemTypeScope* pType =
         counterstrikesharp::interfaces::pSchemaSystem->FindTypeScopeForModule(MODULE_PREFIX "server" MODULE_EXT);
 
     if (!pType) return false;
 
-    auto* pClassInfo = pType->FindDeclaredClass(className);
+    CSchemaClassInfo* pClassInfo = pType->FindDeclaredClass(className);
+
+    if (!pClassInfo) {
+        // Not cached as indexed, so a class registered later is picked up on the next lookup.
+        if (cache.m_missingClasses.insert(classKey).second) {
+            Warning("InitSchemaFieldsForClass(): '%s' was not found!\n", className);
+        }
+        return false;
+    }
+
+    // Flatten the whole inheritance chain into this class so inherited members resolve
+    // directly. The most derived declaration is inserted first and wins on name clashes.
+    unsigned int baseOffset = 0;
+    for (CSchemaClassInfo* pCurrent = pClassInfo; pCurrent != nullptr; pCurrent = pCurrent->GetParent()) {
+        short fieldsSize = pCurrent->m_align;
+        SchemaClassFieldData_t* pFields = pCurrent->m_fields;
 
-    do {
-        SchemaClassFieldData_t* pFields = pClassInfo->m_fields;
-        short fieldsSize = pClassInfo->m_align;
         for (int i = 0; i < fieldsSize; ++i) {
             SchemaClassFieldData_t& field = pFields[i];
 
-            if (V_strcmp(field.m_name, "__m_pChainEntity") == 0) {
-                return field.m_single_inheritance_offset;
-            }
+            cache.Insert(MakeOffsetKey(classKey, hash_32_fnv1a_const(field.m_name)),
+                         {static_cast<int32_t>(baseOffset + field.m_single_inheritance_offset),
+                          IsFieldNetworked(field)});
+        }
+
+        if (pCurrent->m_schema_parent) baseOffset += pCurrent->m_schema_parent->m_offset;
+    }
+
+    cache.m_missingClasses.erase(classKey);
+    cache.m_indexedClasses.insert(classKey);
+
+    static const auto chainEntityKey = hash_32_fnv1a_const("__m_pChainEntity");
+    SchemaKey chainEntity{0, false};
+    cache.Find(MakeOffsetKey(classKey, chainEntityKey), chainEntity);
+
+    // Inserted last, a reader that sees the record also sees every member inserted above.
+    cache.Insert(MakeOffsetKey(classKey, kClassRecordMember), {chainEntity.offset, false});
+
+    return true;
+}
+
+int schema::WarmOffsetCache(const std::string& classListPath) {
+    std::ifstream inputClasses(classListPath);
+    if (!inputClasses) return -1;
+
+    auto& cache = OffsetCache();
+    std::lock_guard<std::mutex> lock(cache.m_writeLock);
+
+    int indexed = 0;
+    std::string line;
+    while (std::getline(inputClasses, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
         }
-    } while ((pClassInfo = pClassInfo->GetParent()) != nullptr);
+
+        if (line.empty()) continue;
+
+        if (InitSchemaFieldsForClass(cache, line.c_str(), hash_32_fnv1a_const(line.c_str()))) indexed++;
+    }
+
+    return indexed;
+}
+
+int16_t schema::FindChainOffset(const char* className) {
+    // Stored on the class record when the class is flattened, including classes without a chain.
+    auto& cache = OffsetCache();
+    const auto classKey = hash_32_fnv1a_const(className);
+    const auto recordKey = MakeOffsetKey(classKey, kClassRecordMember);
+
+    SchemaKey record;
+    if (cache.Find(recordKey, record)) return record.offset;
+
+    std::lock_guard<std::mutex> lock(cache.m_writeLock);
+    if (InitSchemaFieldsForClass(cache, className, classKey) && cache.Find(recordKey, record)) return record.offset;
 
     return 0;
 }
@@ -103,29 +267,273 @@ SchemaKey schema::GetOffset(const char* className,
                             uint32_t classKey,
                             const char* memberName,
                             uint32_t memberKey) {
-    static SchemaTableMap_t schemaTableMap(0, 0, DefLessFunc(uint32_t));
-    int16_t tableMapIndex = schemaTableMap.Find(classKey);
-    if (!schemaTableMap.IsValidIndex(tableMapIndex)) {
-        if (InitSchemaFieldsForClass(&schemaTableMap, className, classKey))
-            return GetOffset(className, classKey, memberName, memberKey);
+    auto& cache = OffsetCache();
+    const auto key = MakeOffsetKey(classKey, memberKey);
+
+    SchemaKey result;
+    if (cache.Find(key, result)) return result;
 
-        return {0, 0};
+    // Already indexed, so the member really is missing. Probe again in case the class was
+    // indexed between the first lookup and the record being published.
+    SchemaKey classRecord;
+    if (cache.Find(MakeOffsetKey(classKey, kClassRecordMember), classRecord)) {
+        return cache.Find(key, result) ? result : SchemaKey{0, 0};
     }
 
-    SchemaKeyValueMap_t* tableMap = schemaTableMap[tableMapIndex];
-    int16_t memberIndex = tableMap->Find(memberKey);
-    if (!tableMap->IsValidIndex(memberIndex)) {
-        return {0, 0};
+    std::lock_guard<std::mutex> lock(cache.m_writeLock);
+    if (InitSchemaFieldsForClass(cache, className, classKey) && cache.Find(key, result)) return result;
+
+    return {0, 0};
+}
+
+template <typename T>
+static void GetFieldValue(counterstrikesharp::ScriptContext& scriptContext, uintptr_t address) {
+    scriptContext.SetResult(*reinterpret_cast<T*>(address));
+}
+
+template <typename T>
+static void SetFieldValue(counterstrikesharp::ScriptContext& scriptContext,
+                          int argumentIndex,
+                          uintptr_t address) {
+    *reinterpret_cast<T*>(address) = scriptContext.GetArgument<T>(argumentIndex);
+}
+
+// Pointer and string reads hand back the field address itself, same as GET_SCHEMA_VALUE_BY_NAME.
+static void GetFieldAddress(counterstrikesharp::ScriptContext& scriptContext, uintptr_t address) {
+    scriptContext.SetResult(reinterpret_cast<void*>(address));
+}
+
+static void SetFieldString(counterstrikesharp::ScriptContext& scriptContext,
+                           int argumentIndex,
+                           uintptr_t address) {
+    *reinterpret_cast<char**>(address) = strdup(scriptContext.GetArgument<const char*>(argumentIndex));
+}
+
+template <typename T>
+static void BindTypedAccessors(SchemaFieldToken& token) {
+    token.get = GetFieldValue<T>;
+    token.set = SetFieldValue<T>;
+    token.size = sizeof(T);
+}
+
+static bool BindFieldAccessors(SchemaFieldToken& token, int dataType) {
+    using namespace counterstrikesharp;
+
+    switch (dataType) {
+    case DATA_TYPE_BOOL:
+        BindTypedAccessors<bool>(token);
+        break;
+    case DATA_TYPE_CHAR:
+        BindTypedAccessors<char>(token);
+        break;
+    case DATA_TYPE_UCHAR:
+        BindTypedAccessors<unsigned char>(token);
+        break;
+    case DATA_TYPE_SHORT:
+        BindTypedAccessors<short>(token);
+        break;
+    case DATA_TYPE_USHORT:
+        BindTypedAccessors<unsigned short>(token);
+        break;
+    case DATA_TYPE_INT:
+        BindTypedAccessors<int>(token);
+        break;
+    case DATA_TYPE_UINT:
+        BindTypedAccessors<unsigned int>(token);
+        break;
+    case DATA_TYPE_LONG:
+        BindTypedAccessors<long>(token);
+        break;
+    case DATA_TYPE_ULONG:
+        BindTypedAccessors<unsigned long>(token);
+        break;
+    case DATA_TYPE_LONG_LONG:
+        BindTypedAccessors<long long>(token);
+        break;
+    case DATA_TYPE_ULONG_LONG:
+        BindTypedAccessors<uint64_t>(token);
+        break;
+    case DATA_TYPE_FLOAT:
+        BindTypedAccessors<float>(token);
+        break;
+    case DATA_TYPE_DOUBLE:
+        BindTypedAccessors<double>(token);
+        break;
+    case DATA_TYPE_POINTER:
+        token.get = GetFieldAddress;
+        token.set = SetFieldValue<void*>;
+        token.size = sizeof(void*);
+        break;
+    case DATA_TYPE_STRING:
+        token.get = GetFieldAddress;
+        token.set = SetFieldString;
+        token.size = sizeof(char*);
+        break;
+    default:
+        return false;
     }
 
-    return tableMap->Element(memberIndex);
+    return true;
 }
 
-void SetStateChanged(Z_CBaseEntity* pEntity, int offset) {
-    // addresses::StateChanged(pEntity->m_NetworkTransmitComponent(), pEntity, offset, -1, -1);
-    auto vars = counterstrikesharp::globals::getGlobalVars();
+// Only needed when a token is resolved, so it is looked up directly instead of being cached.
+static int32_t FindDeclaredFieldSize(const char* className, uint32_t memberKey) {
+    CSchemaSystemTypeScope* pType =
+        counterstrikesharp::interfaces::pSchemaSystem->FindTypeScopeForModule(MODULE_PREFIX "server" MODULE_EXT);
+    if (!pType) return 0;
+
+    CSchemaClassInfo* pClassInfo = pType->FindDeclaredClass(className);
+    for (CSchemaClassInfo* pCurrent = pClassInfo; pCurrent != nullptr; pCurrent = pCurrent->GetParent()) {
+        for (int i = 0; i < pCurrent->m_align; ++i) {
+            SchemaClassFieldData_t& field = pCurrent->m_fields[i];
+            if (hash_32_fnv1a_const(field.m_name) != memberKey) continue;
+
+            int size = 0;
+            return field.m_type && field.m_type->GetSize(&size) ? size : 0;
+        }
+    }
+
+    return 0;
+}
+
+static std::vector<SchemaFieldToken> fieldTokens;
+static std::map<std::tuple<uint32_t, uint32_t, int>, uint32_t> fieldTokenLookup;
+
+uint32_t schema::ResolveFieldToken(const char* className, const char* memberName, int dataType) {
+    auto classKey = hash_32_fnv1a_const(className);
+    auto memberKey = hash_32_fnv1a_const(memberName);
+    auto lookupKey = std::make_tuple(classKey, memberKey, dataType);
+
+    auto it = fieldTokenLookup.find(lookupKey);
+    if (it != fieldTokenLookup.end()) return it->second;
+
+    SchemaFieldToken token{};
+    if (!BindFieldAccessors(token, dataType)) return 0;
+
+    const auto key = GetOffset(className, classKey, memberName, memberKey);
+    token.offset = key.offset;
+    token.networked = key.networked;
+    token.chainOffset = FindChainOffset(className);
+    token.fieldSize = FindDeclaredFieldSize(className, memberKey);
+    token.dataType = dataType;
+    token.writable = !(counterstrikesharp::globals::coreConfig->FollowCS2ServerGuidelines &&
+                       std::find(CS2BadList.begin(), CS2BadList.end(), memberName) != CS2BadList.end());
+
+    fieldTokens.push_back(token);
+    uint32_t handle = static_cast<uint32_t>(fieldTokens.size());
+    fieldTokenLookup.emplace(lookupKey, handle);
+
+    return handle;
+}
+
+const SchemaFieldToken* schema::GetFieldToken(uint32_t token) {
+    if (token == 0 || token > fieldTokens.size()) return nullptr;
+
+    return &fieldTokens[token - 1];
+}
 
-    // if (vars) pEntity->m_lastNetworkChange = vars->curtime;
+using StateChangedFn = void (*)(void* networkTransmitComponent, void* entity, int offset, short, short);
+using NetworkStateChangedFn = void (*)(void* chainEntity, int offset, int64_t unknown);
 
-    // pEntity->m_isSteadyState().ClearAll();
+struct PendingStateChange {
+    uintptr_t owner;
+    uintptr_t instance;
+    int32_t chainOffset;
+    int32_t offset;
 };
+
+// Networked writes are collected for the current frame and flushed once from the GameFrame
+// hook. A field written several times in a frame is only notified once.
+static std::vector<PendingStateChange> pendingStateChanges;
+static std::unordered_set<uintptr_t> pendingStateChangeFields;
+// Entities with at least one pending change, so deleting any other entity skips the scan.
+static std::unordered_set<uintptr_t> pendingStateChangeOwners;
+static schema::StateChangeCounters stateChangeCounters;
+
+static void DispatchStateChanged(CGlobalVars* vars, const PendingStateChange& change) {
+    uintptr_t instance = change.instance;
+
+    if (change.chainOffset != 0) {
+        static auto pNetworkStateChanged = reinterpret_cast<NetworkStateChangedFn>(
+            counterstrikesharp::globals::gameConfig->ResolveSignature("NetworkStateChanged"));
+        if (!pNetworkStateChanged) return;
+
+        pNetworkStateChanged(reinterpret_cast<void*>(instance + change.chainOffset), change.offset, 0xFFFFFFFF);
+        return;
+    }
+
+    static auto pStateChanged = reinterpret_cast<StateChangedFn>(
+        counterstrikesharp::globals::gameConfig->ResolveSignature("StateChanged"));
+    if (!pStateChanged) return;
+
+    static const auto entityKey = hash_32_fnv1a_const("CBaseEntity");
+    static const auto transmitComponent = schema::GetOffset("CBaseEntity", entityKey, "m_NetworkTransmitComponent",
+                                                            hash_32_fnv1a_const("m_NetworkTransmitComponent"));
+    static const auto lastNetworkChange = schema::GetOffset("CBaseEntity", entityKey, "m_lastNetworkChange",
+                                                            hash_32_fnv1a_const("m_lastNetworkChange"));
+    static const auto isSteadyState =
+        schema::GetOffset("CBaseEntity", entityKey, "m_isSteadyState", hash_32_fnv1a_const("m_isSteadyState"));
+
+    pStateChanged(reinterpret_cast<void*>(instance + transmitComponent.offset), reinterpret_cast<void*>(instance),
+                  change.offset, -1, -1);
+
+    if (vars) *reinterpret_cast<float*>(instance + lastNetworkChange.offset) = vars->curtime;
+
+    // m_isSteadyState is a CBitVec<64>.
+    memset(reinterpret_cast<void*>(instance + isSteadyState.offset), 0, sizeof(uint64_t));
+}
+
+void schema::NetworkStateChanged(uintptr_t instance, int32_t chainOffset, int32_t offset) {
+    stateChangeCounters.requested++;
+
+    if (!pendingStateChangeFields.insert(instance + offset).second) {
+        stateChangeCounters.coalesced++;
+        return;
+    }
+
+    // Components reach their entity through the chainer, whose first member is the owning entity.
+    uintptr_t owner = chainOffset != 0 ? *reinterpret_cast<uintptr_t*>(instance + chainOffset) : instance;
+
+    pendingStateChanges.push_back({owner, instance, chainOffset, offset});
+    pendingStateChangeOwners.insert(owner);
+}
+
+void schema::FlushStateChanges() {
+    if (pendingStateChanges.empty()) return;
+
+    auto vars = counterstrikesharp::globals::getGlobalVars();
+    for (const auto& change : pendingStateChanges) {
+        DispatchStateChanged(vars, change);
+    }
+
+    stateChangeCounters.flushed += pendingStateChanges.size();
+
+    pendingStateChanges.clear();
+    pendingStateChangeFields.clear();
+    pendingStateChangeOwners.clear();
+}
+
+void schema::DiscardStateChanges(uintptr_t entity) {
+    if (pendingStateChangeOwners.erase(entity) == 0) return;
+
+    // Compact in place, the elements left behind by remove_if are unspecified so they can't be
+    // used to find the coalescing keys of the discarded changes.
+    size_t kept = 0;
+    for (const auto& change : pendingStateChanges) {
+        if (change.owner == entity) {
+            pendingStateChangeFields.erase(change.instance + change.offset);
+            stateChangeCounters.discarded++;
+            continue;
+        }
+
+        pendingStateChanges[kept++] = change;
+    }
+
+    pendingStateChanges.resize(kept);
+}
+
+schema::StateChangeCounters schema::GetStateChangeCounters() { return stateChangeCounters; }
+
+void SetStateChanged(Z_CBaseEntity* pEntity, int offset) {
+    schema::NetworkStateChanged(reinterpret_cast<uintptr_t>(pEntity), 0, offset);
+}
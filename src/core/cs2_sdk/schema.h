@@ -35,6 +35,35 @@ struct SchemaKey {
     bool networked;
 };
 
+namespace counterstrikesharp {
+class ScriptContext;
+}
+
+/**
+ * Precompiled accessor for a single (class, member, type) triple. Tokens handed
+ * out to managed code are 1-based indices into the token table, 0 is invalid.
+ */
+struct SchemaFieldToken {
+    int32_t offset;
+    int32_t chainOffset;
+    bool networked;
+    bool writable;
+    int dataType;
+    int32_t size;  // bytes copied by bulk reads, pointers and strings copy the stored pointer
+    int32_t fieldSize;  // declared size of the schema field, 0 if the schema did not report one
+    void (*get)(counterstrikesharp::ScriptContext& scriptContext, uintptr_t address);
+    void (*set)(counterstrikesharp::ScriptContext& scriptContext, int argumentIndex, uintptr_t address);
+};
+
+namespace schema {
+struct StateChangeCounters {
+    uint64_t requested;  // networked writes that asked for a notification
+    uint64_t coalesced;  // requests folded into one already pending this frame
+    uint64_t discarded;  // pending requests dropped because the entity was deleted
+    uint64_t flushed;    // notifications actually sent to the engine
+};
+}  // namespace schema
+
 class Z_CBaseEntity;
 void SetStateChanged(Z_CBaseEntity *pEntity, int offset);
 
@@ -97,4 +126,11 @@ static std::vector<std::string> CS2BadList = {
 
 int16_t FindChainOffset(const char *className);
 SchemaKey GetOffset(const char *className, uint32_t classKey, const char *memberName, uint32_t memberKey);
+int WarmOffsetCache(const std::string &classListPath);
+void NetworkStateChanged(uintptr_t instance, int32_t chainOffset, int32_t offset);
+void FlushStateChanges();
+void DiscardStateChanges(uintptr_t entity);
+StateChangeCounters GetStateChangeCounters();
+uint32_t ResolveFieldToken(const char *className, const char *memberName, int dataType);
+const SchemaFieldToken *GetFieldToken(uint32_t token);
 }  // namespace schema
@@ -1,5 +1,8 @@
 #include "core/gameconfig.h"
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <thread>
 
 #include "log.h"
 #include "metamod_oslink.h"
@@ -144,6 +147,10 @@ bool CGameConfig::IsSymbol(const char* name)
 
 void* CGameConfig::ResolveSignature(const char* name)
 {
+    if (auto it = m_umAddresses.find(name); it != m_umAddresses.end()) {
+        return it->second;
+    }
+
     modules::CModule** module = this->GetModule(name);
     if (!module || !(*module)) {
         CSSHARP_CORE_ERROR("Invalid Module {}\n", name);
@@ -170,15 +177,129 @@ void* CGameConfig::ResolveSignature(const char* name)
             return nullptr;
         }
         address = (*module)->FindSignature(pSignature, iLength);
+        delete[] pSignature;
     }
 
     if (!address) {
         CSSHARP_CORE_ERROR("Failed to find address for {}\n", name);
         return nullptr;
     }
+
+    m_umAddresses[name] = address;
     return address;
 }
 
+void CGameConfig::ResolveSignatures()
+{
+    struct ModuleSignatures
+    {
+        modules::CModule* module;
+        std::vector<std::string> names;
+        std::vector<modules::CSignature> signatures;
+        std::vector<const modules::CSignature*> pending;
+        std::vector<size_t> pendingIndices;
+    };
+
+    struct ScanJob
+    {
+        ModuleSignatures* target;
+        size_t rangeBegin;
+        size_t rangeEnd;
+        std::vector<void*> results;
+    };
+
+    std::unordered_map<modules::CModule*, ModuleSignatures> byModule;
+
+    for (const auto& [name, signature] : m_umSignatures) {
+        if (signature.empty() || signature[0] == '@' || m_umAddresses.count(name)) {
+            continue;
+        }
+
+        modules::CModule** module = this->GetModule(name.c_str());
+        if (!module || !(*module)) {
+            continue;
+        }
+
+        size_t iLength = 0;
+        byte* pSignature = HexToByte(signature.c_str(), iLength);
+        if (!pSignature) {
+            continue;
+        }
+
+        auto& target = byModule[*module];
+        target.module = *module;
+        target.names.push_back(name);
+        target.signatures.emplace_back(pSignature, iLength);
+        delete[] pSignature;
+    }
+
+    // Split every module into chunks so the scan is spread over all cores, not one per module.
+    const size_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+    constexpr size_t kMinChunkSize = 1 << 20;
+
+    std::vector<ScanJob> jobs;
+    for (auto& [module, target] : byModule) {
+        for (size_t i = 0; i < target.signatures.size(); i++) {
+            void* address;
+            if (module->FindCachedSignature(target.signatures[i], address)) {
+                if (address) {
+                    m_umAddresses[target.names[i]] = address;
+                }
+                continue;
+            }
+
+            target.pending.push_back(&target.signatures[i]);
+            target.pendingIndices.push_back(i);
+        }
+
+        if (target.pending.empty()) {
+            continue;
+        }
+
+        size_t chunkSize = std::max(kMinChunkSize, module->m_size / workerCount + 1);
+        for (size_t begin = 0; begin < module->m_size; begin += chunkSize) {
+            jobs.push_back({&target, begin, std::min(begin + chunkSize, module->m_size), {}});
+        }
+    }
+
+    std::atomic<size_t> nextJob{0};
+    auto worker = [&jobs, &nextJob]() {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+            auto& job = jobs[i];
+            job.target->module->ScanSignatures(job.target->pending, job.rangeBegin, job.rangeEnd, job.results);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(workerCount, jobs.size()); i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    // Jobs of a module are in address order, so the first chunk with a hit has the first match.
+    for (const auto& job : jobs) {
+        auto* target = job.target;
+        for (size_t i = 0; i < job.results.size(); i++) {
+            const auto& name = target->names[target->pendingIndices[i]];
+            if (job.results[i] && !m_umAddresses.count(name)) {
+                m_umAddresses[name] = job.results[i];
+            }
+        }
+    }
+
+    for (auto& [module, target] : byModule) {
+        for (size_t i = 0; i < target.pending.size(); i++) {
+            auto it = m_umAddresses.find(target.names[target.pendingIndices[i]]);
+            module->CacheSignature(*target.pending[i], it != m_umAddresses.end() ? it->second : nullptr);
+        }
+    }
+
+    CSSHARP_CORE_INFO("Resolved {} gamedata signatures using {} scan jobs.", m_umAddresses.size(), jobs.size());
+}
+
 std::string CGameConfig::GetDirectoryName(const std::string& directoryPathInput)
 {
     std::string directoryPath = std::string(directoryPathInput);
@@ -225,10 +346,12 @@ byte* CGameConfig::HexToByte(const char* src, size_t& length)
     }
 
     length = strlen(src) / 4;
-    uint8_t* dest = new uint8_t[length];
+    // HexStringToUint8Array null-terminates the output, so leave room for it.
+    uint8_t* dest = new uint8_t[length + 1];
     int byteCount = HexStringToUint8Array(src, dest, length);
     if (byteCount <= 0) {
         CSSHARP_CORE_INFO("Invalid hex format %s\n", src);
+        delete[] dest;
         return nullptr;
     }
     return dest;
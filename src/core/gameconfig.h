@@ -31,6 +31,7 @@ class CGameConfig
     modules::CModule** GetModule(const char* name);
     bool IsSymbol(const char* name);
     void* ResolveSignature(const char* name);
+    void ResolveSignatures();
 
     static std::string GetDirectoryName(const std::string& directoryPathInput);
     static int HexStringToUint8Array(const char* hexString, uint8_t* byteArray, size_t maxBytes);
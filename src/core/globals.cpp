@@ -68,6 +68,7 @@ ISmmAPI* ismm = nullptr;
 CGameEntitySystem* entitySystem = nullptr;
 CCoreConfig* coreConfig = nullptr;
 CGameConfig* gameConfig = nullptr;
+CSignatureCache* signatureCache = nullptr;
 
 // Custom Managers
 CallbackManager callbackManager;
@@ -92,12 +93,14 @@ void Initialize()
     modules::schemasystem = new modules::CModule(ROOTBIN, "schemasystem");
     modules::vscript = new modules::CModule(ROOTBIN, "vscript");
 
+    gameConfig->ResolveSignatures();
+
     interfaces::Initialize();
 
     entitySystem = interfaces::pGameResourceServiceServer->GetGameEntitySystem();
 
-    GetLegacyGameEventListener = reinterpret_cast<GetLegacyGameEventListener_t*>(modules::server->FindSignature(
-            globals::gameConfig->GetSignature("LegacyGameEventListener")));
+    GetLegacyGameEventListener = reinterpret_cast<GetLegacyGameEventListener_t*>(
+        globals::gameConfig->ResolveSignature("LegacyGameEventListener"));
 
     if (int offset = -1; (offset = gameConfig->GetOffset("GameEventManager")) != -1) {
         gameEventManager = (IGameEventManager2*)(CALL_VIRTUAL(uintptr_t, offset, server) - 8);
@@ -56,6 +56,7 @@ class ServerManager;
 class VoiceManager;
 class CCoreConfig;
 class CGameConfig;
+class CSignatureCache;
 
 namespace globals {
 
@@ -109,6 +110,7 @@ extern CounterStrikeSharpMMPlugin *mmPlugin;
 extern ISmmAPI *ismm;
 extern CCoreConfig* coreConfig;
 extern CGameConfig* gameConfig;
+extern CSignatureCache* signatureCache;
 
 typedef IGameEventListener2 *GetLegacyGameEventListener_t(CPlayerSlot slot);
 
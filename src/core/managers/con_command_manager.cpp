@@ -319,7 +319,7 @@ HookResult ConCommandManager::ExecuteCommandCallbacks(const char* name, const CC
 
     auto globalCallback = mode == HookMode::Pre ? m_global_cmd.callback_pre : m_global_cmd.callback_post;
 
-    if (globalCallback->GetFunctionCount() > 0) {
+    if (globalCallback->HasListeners()) {
         globalCallback->ScriptContext().Reset();
         globalCallback->ScriptContext().Push(ctx.GetPlayerSlot().Get());
         globalCallback->ScriptContext().Push(&args);
@@ -17,8 +17,10 @@
 #include "core/managers/entity_manager.h"
 #include "core/gameconfig.h"
 #include "core/log.h"
+#include "core/cs2_sdk/schema.h"
 
 #include <funchook.h>
+#include <cstring>
 #include <vector>
 
 #include <public/eiface.h>
@@ -38,8 +40,8 @@ void EntityManager::OnAllInitialized()
     on_entity_parent_changed_callback =
         globals::callbackManager.CreateCallback("OnEntityParentChanged");
 
-    m_pFireOutputInternal = reinterpret_cast<FireOutputInternal>(modules::server->FindSignature(
-        globals::gameConfig->GetSignature("CEntityIOOutput_FireOutputInternal")));
+    m_pFireOutputInternal = reinterpret_cast<FireOutputInternal>(
+        globals::gameConfig->ResolveSignature("CEntityIOOutput_FireOutputInternal"));
 
     if (m_pFireOutputInternal == nullptr) {
         CSSHARP_CORE_CRITICAL("Failed to find signature for \'CEntityIOOutput_FireOutputInternal\'");
@@ -59,63 +61,480 @@ void EntityManager::OnShutdown()
     globals::callbackManager.ReleaseCallback(on_entity_created_callback);
     globals::callbackManager.ReleaseCallback(on_entity_deleted_callback);
     globals::callbackManager.ReleaseCallback(on_entity_parent_changed_callback);
+
+    for (auto& filters : m_entityListenerFilters) {
+        for (auto& pFilter : filters) {
+            globals::callbackManager.ReleaseCallback(pFilter->m_pCallback);
+        }
+        filters.clear();
+    }
+
     globals::entitySystem->RemoveListenerEntity(&entityListener);
 }
 
 void CEntityListener::OnEntitySpawned(CEntityInstance* pEntity)
 {
+    globals::entityManager.IndexEntity(pEntity);
+
     auto callback = globals::entityManager.on_entity_spawned_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(pEntity);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(pEntity);
     }
+
+    globals::entityManager.DispatchEntityListenerFilters(EntityListenerType::Spawned, pEntity);
 }
 void CEntityListener::OnEntityCreated(CEntityInstance* pEntity)
 {
+    globals::entityManager.IndexEntity(pEntity);
+
     auto callback = globals::entityManager.on_entity_created_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(pEntity);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(pEntity);
     }
+
+    globals::entityManager.DispatchEntityListenerFilters(EntityListenerType::Created, pEntity);
 }
 void CEntityListener::OnEntityDeleted(CEntityInstance* pEntity)
 {
     auto callback = globals::entityManager.on_entity_deleted_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(pEntity);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(pEntity);
     }
+
+    globals::entityManager.DispatchEntityListenerFilters(EntityListenerType::Deleted, pEntity);
+    globals::entityManager.UnindexEntity(pEntity);
+
+    schema::DiscardStateChanges(reinterpret_cast<uintptr_t>(pEntity));
 }
 void CEntityListener::OnEntityParentChanged(CEntityInstance* pEntity, CEntityInstance* pNewParent)
 {
     auto callback = globals::entityManager.on_entity_parent_changed_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(pEntity);
-        callback->ScriptContext().Push(pNewParent);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(pEntity, pNewParent);
+    }
+}
+
+// Glob match supporting `*` (any run of characters) and `?` (any single character).
+static bool MatchesDesignerName(const char* szPattern, const char* szName)
+{
+    const char* pStar = nullptr;
+    const char* pResume = nullptr;
+
+    while (*szName) {
+        if (*szPattern == '*') {
+            pStar = szPattern++;
+            pResume = szName;
+        } else if (*szPattern == '?' || *szPattern == *szName) {
+            szPattern++;
+            szName++;
+        } else if (pStar) {
+            szPattern = pStar + 1;
+            szName = ++pResume;
+        } else {
+            return false;
+        }
+    }
+
+    while (*szPattern == '*') {
+        szPattern++;
+    }
+
+    return *szPattern == '\0';
+}
+
+EntityListenerFilter_t* EntityManager::FindEntityListenerFilter(EntityListenerType type,
+                                                                const char* szDesignerName)
+{
+    for (auto& pFilter : m_entityListenerFilters[static_cast<int>(type)]) {
+        if (pFilter->m_pattern == szDesignerName) {
+            return pFilter.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void EntityManager::HookEntityListener(EntityListenerType type, const char* szDesignerName,
+                                       CallbackT fnCallback)
+{
+    auto* pFilter = FindEntityListenerFilter(type, szDesignerName);
+
+    if (!pFilter) {
+        auto filter = std::make_unique<EntityListenerFilter_t>();
+        filter->m_pattern = szDesignerName;
+        filter->m_bWildcard = strpbrk(szDesignerName, "*?") != nullptr;
+        filter->m_pCallback = globals::callbackManager.CreateCallback("");
+        filter->m_hits = 0;
+
+        pFilter = filter.get();
+        m_entityListenerFilters[static_cast<int>(type)].push_back(std::move(filter));
+    }
+
+    pFilter->m_pCallback->AddListener(fnCallback);
+}
+
+void EntityManager::UnhookEntityListener(EntityListenerType type, const char* szDesignerName,
+                                         CallbackT fnCallback)
+{
+    auto* pFilter = FindEntityListenerFilter(type, szDesignerName);
+    if (!pFilter) {
+        return;
+    }
+
+    pFilter->m_pCallback->RemoveListener(fnCallback);
+
+    // A filter unhooked from inside its own callback is released once dispatch unwinds.
+    if (m_entityListenerDispatchDepth == 0) {
+        ReleaseUnusedEntityListenerFilters();
+    } else {
+        m_entityListenerReleasePending = true;
+    }
+}
+
+void EntityManager::ReleaseUnusedEntityListenerFilters()
+{
+    for (auto& filters : m_entityListenerFilters) {
+        for (auto it = filters.begin(); it != filters.end();) {
+            if ((*it)->m_pCallback->HasListeners()) {
+                ++it;
+                continue;
+            }
+
+            globals::callbackManager.ReleaseCallback((*it)->m_pCallback);
+            it = filters.erase(it);
+        }
+    }
+}
+
+uint64_t EntityManager::GetEntityListenerHits(EntityListenerType type, const char* szDesignerName)
+{
+    auto* pFilter = FindEntityListenerFilter(type, szDesignerName);
+    return pFilter ? pFilter->m_hits : 0;
+}
+
+void EntityManager::DispatchEntityListenerFilters(EntityListenerType type, CEntityInstance* pEntity)
+{
+    auto& filters = m_entityListenerFilters[static_cast<int>(type)];
+    if (filters.empty()) {
+        return;
+    }
+
+    const char* szDesignerName = pEntity->GetClassname();
+    if (!szDesignerName) {
+        return;
+    }
+
+    // Indexed on purpose, a listener may hook or unhook filters while we are dispatching.
+    m_entityListenerDispatchDepth++;
+    for (size_t i = 0; i < filters.size(); i++) {
+        auto* pFilter = filters[i].get();
+
+        bool bMatches = pFilter->m_bWildcard
+                            ? MatchesDesignerName(pFilter->m_pattern.c_str(), szDesignerName)
+                            : strcmp(pFilter->m_pattern.c_str(), szDesignerName) == 0;
+        if (!bMatches) {
+            continue;
+        }
+
+        pFilter->m_hits++;
+        pFilter->m_pCallback->Dispatch(pEntity);
+    }
+
+    if (--m_entityListenerDispatchDepth == 0 && m_entityListenerReleasePending) {
+        m_entityListenerReleasePending = false;
+        ReleaseUnusedEntityListenerFilters();
+    }
+}
+
+void EntityManager::OnStartupServer()
+{
+    m_designerNameIndex.clear();
+    m_designerNameSlots.clear();
+    m_spatialGrid.Clear();
+    m_spatialGridTick = -1;
+    m_spatialGridDirty = true;
+
+    // Catch up on anything that was created before the listener was attached.
+    for (auto pIdentity = globals::entitySystem->m_EntityList.m_pFirstActiveEntity; pIdentity;
+         pIdentity = pIdentity->m_pNext) {
+        if (pIdentity->m_pInstance) {
+            IndexEntity(pIdentity->m_pInstance);
+        }
+    }
+}
+
+void EntityManager::IndexEntity(CEntityInstance* pEntity)
+{
+    auto hEntity = pEntity->GetRefEHandle();
+    if (!hEntity.IsValid()) {
+        return;
+    }
+
+    const char* szDesignerName = pEntity->GetClassname();
+    if (!szDesignerName) {
+        return;
+    }
+
+    auto entryIndex = static_cast<size_t>(hEntity.GetEntryIndex());
+    if (entryIndex >= m_designerNameSlots.size()) {
+        m_designerNameSlots.resize(entryIndex + 1);
+    }
+
+    auto& slot = m_designerNameSlots[entryIndex];
+    if (slot.m_pBucket) {
+        if (slot.m_pBucket->m_handles[slot.m_position] == hEntity.ToInt() &&
+            slot.m_pBucket->m_designerName == szDesignerName) {
+            return;
+        }
+
+        // Renamed since creation, or the entry was reused without us seeing the delete.
+        UnindexEntity(pEntity);
+    }
+
+    auto search = m_designerNameIndex.find(szDesignerName);
+    if (search == m_designerNameIndex.end()) {
+        auto bucket = std::make_unique<DesignerNameBucket_t>();
+        bucket->m_designerName = szDesignerName;
+
+        std::string_view key = bucket->m_designerName;
+        search = m_designerNameIndex.emplace(key, std::move(bucket)).first;
+    }
+
+    auto* pBucket = search->second.get();
+    slot.m_pBucket = pBucket;
+    m_spatialGridDirty = true;
+    slot.m_position = static_cast<uint32_t>(pBucket->m_handles.size());
+    pBucket->m_handles.push_back(hEntity.ToInt());
+}
+
+void EntityManager::UnindexEntity(CEntityInstance* pEntity)
+{
+    auto hEntity = pEntity->GetRefEHandle();
+    if (!hEntity.IsValid()) {
+        return;
+    }
+
+    auto entryIndex = static_cast<size_t>(hEntity.GetEntryIndex());
+    if (entryIndex >= m_designerNameSlots.size()) {
+        return;
+    }
+
+    auto& slot = m_designerNameSlots[entryIndex];
+    auto* pBucket = slot.m_pBucket;
+    if (!pBucket) {
+        return;
+    }
+
+    auto& handles = pBucket->m_handles;
+    auto lastHandle = handles.back();
+    handles[slot.m_position] = lastHandle;
+    handles.pop_back();
+
+    if (slot.m_position < handles.size()) {
+        CEntityHandle hMoved(lastHandle);
+        m_designerNameSlots[hMoved.GetEntryIndex()].m_position = slot.m_position;
+    }
+
+    slot = DesignerNameSlot_t{};
+    m_spatialGridDirty = true;
+}
+
+int EntityManager::GetEntitiesByDesignerName(const char* szDesignerName, bool bExact,
+                                             uint32_t* pHandles, int capacity) const
+{
+    int total = 0;
+
+    auto append = [&](const DesignerNameBucket_t& bucket) {
+        for (auto handle : bucket.m_handles) {
+            if (total < capacity) {
+                pHandles[total] = handle;
+            }
+            total++;
+        }
+    };
+
+    if (bExact) {
+        auto search = m_designerNameIndex.find(szDesignerName);
+        if (search != m_designerNameIndex.end()) {
+            append(*search->second);
+        }
+
+        return total;
+    }
+
+    // Substring match over the distinct names, which are far fewer than the entities.
+    for (const auto& [name, pBucket] : m_designerNameIndex) {
+        if (strstr(pBucket->m_designerName.c_str(), szDesignerName)) {
+            append(*pBucket);
+        }
+    }
+
+    return total;
+}
+
+// Reads CBaseEntity -> m_CBodyComponent -> m_pSceneNode -> m_vecAbsOrigin.
+static bool GetEntityAbsOrigin(CEntityInstance* pEntity, Vector& origin)
+{
+    static const auto bodyComponentOffset =
+        schema::GetOffset("CBaseEntity", hash_32_fnv1a_const("CBaseEntity"), "m_CBodyComponent",
+                          hash_32_fnv1a_const("m_CBodyComponent"))
+            .offset;
+    static const auto sceneNodeOffset =
+        schema::GetOffset("CBodyComponent", hash_32_fnv1a_const("CBodyComponent"), "m_pSceneNode",
+                          hash_32_fnv1a_const("m_pSceneNode"))
+            .offset;
+    static const auto absOriginOffset =
+        schema::GetOffset("CGameSceneNode", hash_32_fnv1a_const("CGameSceneNode"),
+                          "m_vecAbsOrigin", hash_32_fnv1a_const("m_vecAbsOrigin"))
+            .offset;
+
+    if (!bodyComponentOffset || !sceneNodeOffset || !absOriginOffset) {
+        return false;
+    }
+
+    auto pBodyComponent =
+        *reinterpret_cast<uintptr_t*>(reinterpret_cast<uintptr_t>(pEntity) + bodyComponentOffset);
+    if (!pBodyComponent) {
+        return false;
+    }
+
+    auto pSceneNode = *reinterpret_cast<uintptr_t*>(pBodyComponent + sceneNodeOffset);
+    if (!pSceneNode) {
+        return false;
+    }
+
+    origin = *reinterpret_cast<Vector*>(pSceneNode + absOriginOffset);
+    return true;
+}
+
+bool EntityManager::RefreshSpatialGrid(const char* szDesignerName, const void*& pTag)
+{
+    pTag = nullptr;
+    if (szDesignerName && *szDesignerName) {
+        auto search = m_designerNameIndex.find(szDesignerName);
+        if (search == m_designerNameIndex.end()) {
+            return false;
+        }
+
+        pTag = search->second.get();
+    }
+
+    auto pGlobalVars = globals::getGlobalVars();
+    auto tick = pGlobalVars ? pGlobalVars->tickcount : -1;
+    if (!m_spatialGridDirty && tick == m_spatialGridTick) {
+        return true;
+    }
+
+    m_spatialGrid.Clear();
+
+    for (const auto& [name, pBucket] : m_designerNameIndex) {
+        for (auto handle : pBucket->m_handles) {
+            auto pEntity = globals::entitySystem->GetBaseEntity(CEntityHandle(handle));
+            Vector origin;
+
+            if (pEntity && GetEntityAbsOrigin(pEntity, origin)) {
+                m_spatialGrid.Add(origin, handle, pBucket.get());
+            }
+        }
+    }
+
+    m_spatialGrid.Build();
+    m_spatialGridTick = tick;
+    m_spatialGridDirty = false;
+
+    return true;
+}
+
+int EntityManager::FindEntitiesInRadius(const Vector& center, float radius,
+                                        const char* szDesignerName, uint32_t* pHandles,
+                                        int capacity)
+{
+    const void* pTag;
+    if (!RefreshSpatialGrid(szDesignerName, pTag)) {
+        return 0;
+    }
+
+    return m_spatialGrid.QueryRadius(center, radius, pTag, pHandles, capacity);
+}
+
+int EntityManager::FindEntitiesInBox(const Vector& mins, const Vector& maxs,
+                                     const char* szDesignerName, uint32_t* pHandles, int capacity)
+{
+    const void* pTag;
+    if (!RefreshSpatialGrid(szDesignerName, pTag)) {
+        return 0;
+    }
+
+    return m_spatialGrid.QueryBox(mins, maxs, pTag, pHandles, capacity);
+}
+
+int EntityManager::FindNearestEntities(const Vector& center, float maxRadius,
+                                       const char* szDesignerName, uint32_t* pHandles, int count)
+{
+    const void* pTag;
+    if (!RefreshSpatialGrid(szDesignerName, pTag)) {
+        return 0;
+    }
+
+    return m_spatialGrid.QueryNearest(center, maxRadius, pTag, pHandles, count);
+}
+
+// FNV-1a over the classname and output name, with a separator so ("ab", "c") != ("a", "bc").
+static constexpr uint64_t kOutputHashBasis = 0xcbf29ce484222325ull;
+static constexpr uint64_t kOutputHashPrime = 0x100000001b3ull;
+
+static uint64_t HashOutputPart(uint64_t hash, const char* szPart)
+{
+    for (; *szPart; szPart++) {
+        hash ^= static_cast<unsigned char>(*szPart);
+        hash *= kOutputHashPrime;
+    }
+
+    // Terminator acts as the separator between classname and output.
+    return hash * kOutputHashPrime;
+}
+
+static uint64_t HashOutputKey(const char* szClassname, const char* szOutput)
+{
+    return HashOutputPart(HashOutputPart(kOutputHashBasis, szClassname), szOutput);
+}
+
+CallbackPair* EntityManager::FindOutputHook(uint64_t hash, const char* szClassname,
+                                            const char* szOutput) const
+{
+    auto search = m_pHookMap.find(hash);
+    if (search == m_pHookMap.end()) {
+        return nullptr;
+    }
+
+    const auto& hook = search->second;
+    if (hook.m_classname != szClassname || hook.m_output != szOutput) {
+        return nullptr;
     }
+
+    return hook.m_pCallbackPair;
 }
 
 void EntityManager::HookEntityOutput(const char* szClassname, const char* szOutput,
                                      CallbackT fnCallback, HookMode mode)
 {
-    auto outputKey = OutputKey_t(szClassname, szOutput);
+    auto hash = HashOutputKey(szClassname, szOutput);
     CallbackPair* pCallbackPair;
 
-    auto search = m_pHookMap.find(outputKey);
+    auto search = m_pHookMap.find(hash);
     if (search == m_pHookMap.end()) {
-        m_pHookMap[outputKey] = new CallbackPair();
-        pCallbackPair = m_pHookMap[outputKey];
+        pCallbackPair = new CallbackPair();
+        m_pHookMap[hash] = OutputHook_t{szClassname, szOutput, pCallbackPair};
+    } else if (search->second.m_classname != szClassname || search->second.m_output != szOutput) {
+        CSSHARP_CORE_ERROR("[EntityManager] Output hook {}:{} collides with {}:{}", szClassname,
+                           szOutput, search->second.m_classname, search->second.m_output);
+        return;
     } else
-        pCallbackPair = search->second;
+        pCallbackPair = search->second.m_pCallbackPair;
 
     auto* pCallback = mode == HookMode::Pre ? pCallbackPair->pre : pCallbackPair->post;
     pCallback->AddListener(fnCallback);
@@ -124,18 +543,16 @@ void EntityManager::HookEntityOutput(const char* szClassname, const char* szOutp
 void EntityManager::UnhookEntityOutput(const char* szClassname, const char* szOutput,
                                        CallbackT fnCallback, HookMode mode)
 {
-    auto outputKey = OutputKey_t(szClassname, szOutput);
-
-    auto search = m_pHookMap.find(outputKey);
-    if (search != m_pHookMap.end()) {
-        auto* pCallbackPair = search->second;
+    auto hash = HashOutputKey(szClassname, szOutput);
 
+    auto* pCallbackPair = FindOutputHook(hash, szClassname, szOutput);
+    if (pCallbackPair) {
         auto* pCallback = mode == Pre ? pCallbackPair->pre : pCallbackPair->post;
 
         pCallback->RemoveListener(fnCallback);
 
         if (!pCallbackPair->HasCallbacks()) {
-            m_pHookMap.erase(outputKey);
+            m_pHookMap.erase(hash);
         }
     }
 }
@@ -143,39 +560,49 @@ void EntityManager::UnhookEntityOutput(const char* szClassname, const char* szOu
 void DetourFireOutputInternal(CEntityIOOutput* const pThis, CEntityInstance* pActivator,
                               CEntityInstance* pCaller, const CVariant* const value, float flDelay)
 {
-    std::vector vecSearchKeys{OutputKey_t("*", pThis->m_pDesc->m_pName),
-        OutputKey_t("*", "*")};
+    auto& entityManager = globals::entityManager;
 
-    if (pCaller) {
-        vecSearchKeys.push_back(OutputKey_t(pCaller->GetClassname(), pThis->m_pDesc->m_pName));
-        OutputKey_t(pCaller->GetClassname(), "*");
+    // Nothing hooked anywhere, which is the common case on busy maps.
+    if (entityManager.m_pHookMap.empty()) {
+        m_pFireOutputInternal(pThis, pActivator, pCaller, value, flDelay);
+        return;
     }
 
-    std::vector<CallbackPair*> vecCallbackPairs;
+    const char* szOutput = pThis->m_pDesc->m_pName;
 
-    if (pCaller) {
-        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, {}", pThis->m_pDesc->m_pName,
-                           pCaller->GetClassname());
+    static const uint64_t wildcardHash = HashOutputPart(kOutputHashBasis, "*");
+    const auto wildcardOutputHash = HashOutputPart(wildcardHash, szOutput);
 
-        auto& hookMap = globals::entityManager.m_pHookMap;
+    CallbackPair* callbackPairs[4];
+    size_t callbackPairCount = 0;
 
-        for (auto& searchKey : vecSearchKeys) {
-            auto search = hookMap.find(searchKey);
-            if (search != hookMap.end()) {
-                vecCallbackPairs.push_back(search->second);
-            }
+    auto addHook = [&](uint64_t hash, const char* szClassname, const char* szOutputName) {
+        if (auto* pCallbackPair = entityManager.FindOutputHook(hash, szClassname, szOutputName)) {
+            callbackPairs[callbackPairCount++] = pCallbackPair;
         }
+    };
+
+    if (pCaller) {
+        const char* szClassname = pCaller->GetClassname();
+        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, {}", szOutput, szClassname);
+
+        const auto classnameHash = HashOutputPart(kOutputHashBasis, szClassname);
+
+        addHook(wildcardOutputHash, "*", szOutput);
+        addHook(HashOutputPart(wildcardHash, "*"), "*", "*");
+        addHook(HashOutputPart(classnameHash, szOutput), szClassname, szOutput);
+        addHook(HashOutputPart(classnameHash, "*"), szClassname, "*");
     } else
-        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, unknown caller",
-                           pThis->m_pDesc->m_pName);
+        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, unknown caller", szOutput);
 
     HookResult result = HookResult::Continue;
 
-    for (auto pCallbackPair : vecCallbackPairs) {
-        if (pCallbackPair->pre->GetFunctionCount()) {
+    for (size_t i = 0; i < callbackPairCount; i++) {
+        auto pCallbackPair = callbackPairs[i];
+        if (pCallbackPair->pre->HasListeners()) {
             pCallbackPair->pre->ScriptContext().Reset();
             pCallbackPair->pre->ScriptContext().Push(pThis);
-            pCallbackPair->pre->ScriptContext().Push(pThis->m_pDesc->m_pName);
+            pCallbackPair->pre->ScriptContext().Push(szOutput);
             pCallbackPair->pre->ScriptContext().Push(pActivator);
             pCallbackPair->pre->ScriptContext().Push(pCaller);
             pCallbackPair->pre->ScriptContext().Push(value);
@@ -205,17 +632,8 @@ void DetourFireOutputInternal(CEntityIOOutput* const pThis, CEntityInstance* pAc
 
     m_pFireOutputInternal(pThis, pActivator, pCaller, value, flDelay);
 
-    for (auto pCallbackPair : vecCallbackPairs) {
-        if (pCallbackPair->post->GetFunctionCount()) {
-            pCallbackPair->post->ScriptContext().Reset();
-            pCallbackPair->post->ScriptContext().Push(pThis);
-            pCallbackPair->post->ScriptContext().Push(pThis->m_pDesc->m_pName);
-            pCallbackPair->post->ScriptContext().Push(pActivator);
-            pCallbackPair->post->ScriptContext().Push(pCaller);
-            pCallbackPair->post->ScriptContext().Push(value);
-            pCallbackPair->post->ScriptContext().Push(flDelay);
-            pCallbackPair->post->Execute();
-        }
+    for (size_t i = 0; i < callbackPairCount; i++) {
+        callbackPairs[i]->post->Dispatch(pThis, szOutput, pActivator, pCaller, value, flDelay);
     }
 }
 
@@ -16,11 +16,16 @@
 
 #pragma once
 
-#include <map>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "core/globals.h"
 #include "core/global_listener.h"
+#include "core/spatial_grid.h"
 #include "scripting/script_engine.h"
 #include "entitysystem.h"
 #include "scripting/callback_manager.h"
@@ -30,7 +35,43 @@
 namespace counterstrikesharp {
 class ScriptCallback;
 
-typedef std::pair<std::string, std::string> OutputKey_t;
+/**
+ * Output hooks are indexed by a hash of (classname, output name) so dispatch can probe
+ * with the raw engine strings. The names are kept to rule out hash collisions.
+ */
+struct OutputHook_t {
+    std::string m_classname;
+    std::string m_output;
+    CallbackPair* m_pCallbackPair;
+};
+
+enum class EntityListenerType : int
+{
+    Created = 0,
+    Spawned = 1,
+    Deleted = 2,
+    Count
+};
+
+/**
+ * Native side filter on an entity lifecycle listener. Only entities whose designer name
+ * matches `m_pattern` (which may use `*` and `?`) are handed to managed code.
+ */
+struct EntityListenerFilter_t {
+    std::string m_pattern;
+    bool m_bWildcard;
+    ScriptCallback* m_pCallback;
+    uint64_t m_hits;
+};
+
+/**
+ * Live entities sharing a designer name, kept as a dense array of raw entity handles.
+ * Removal swaps the last handle into the freed position.
+ */
+struct DesignerNameBucket_t {
+    std::string m_designerName;
+    std::vector<uint32_t> m_handles;
+};
 
 class CEntityListener : public IEntityListener {
     void OnEntitySpawned(CEntityInstance *pEntity) override;
@@ -49,8 +90,51 @@ public:
     void HookEntityOutput(const char* szClassname, const char* szOutput, CallbackT fnCallback, HookMode mode);
     void UnhookEntityOutput(const char* szClassname, const char* szOutput, CallbackT fnCallback, HookMode mode);
     CEntityListener entityListener;
-    std::map<OutputKey_t, CallbackPair*> m_pHookMap;
+    std::unordered_map<uint64_t, OutputHook_t> m_pHookMap;
+
+    CallbackPair* FindOutputHook(uint64_t hash, const char* szClassname, const char* szOutput) const;
+
+    void HookEntityListener(EntityListenerType type, const char* szDesignerName, CallbackT fnCallback);
+    void UnhookEntityListener(EntityListenerType type, const char* szDesignerName, CallbackT fnCallback);
+    uint64_t GetEntityListenerHits(EntityListenerType type, const char* szDesignerName);
+
+    void OnStartupServer();
+    int GetEntitiesByDesignerName(const char* szDesignerName, bool bExact, uint32_t* pHandles,
+                                  int capacity) const;
+
+    int FindEntitiesInRadius(const Vector& center, float radius, const char* szDesignerName,
+                             uint32_t* pHandles, int capacity);
+    int FindEntitiesInBox(const Vector& mins, const Vector& maxs, const char* szDesignerName,
+                          uint32_t* pHandles, int capacity);
+    int FindNearestEntities(const Vector& center, float maxRadius, const char* szDesignerName,
+                            uint32_t* pHandles, int count);
 private:
+    void IndexEntity(CEntityInstance* pEntity);
+    void UnindexEntity(CEntityInstance* pEntity);
+    bool RefreshSpatialGrid(const char* szDesignerName, const void*& pTag);
+    EntityListenerFilter_t* FindEntityListenerFilter(EntityListenerType type, const char* szDesignerName);
+    void DispatchEntityListenerFilters(EntityListenerType type, CEntityInstance* pEntity);
+    void ReleaseUnusedEntityListenerFilters();
+
+    std::vector<std::unique_ptr<EntityListenerFilter_t>>
+        m_entityListenerFilters[static_cast<int>(EntityListenerType::Count)];
+    int m_entityListenerDispatchDepth = 0;
+    bool m_entityListenerReleasePending = false;
+
+    struct DesignerNameSlot_t {
+        DesignerNameBucket_t* m_pBucket = nullptr;
+        uint32_t m_position = 0;
+    };
+
+    // Keys view into the bucket's own m_designerName so lookups from engine strings never allocate.
+    std::unordered_map<std::string_view, std::unique_ptr<DesignerNameBucket_t>> m_designerNameIndex;
+    std::vector<DesignerNameSlot_t> m_designerNameSlots;
+
+    // Rebuilt from entity origins at most once per tick, and only when someone queries it.
+    SpatialGrid m_spatialGrid;
+    int m_spatialGridTick = -1;
+    bool m_spatialGridDirty = true;
+
     ScriptCallback *on_entity_spawned_callback;
     ScriptCallback *on_entity_created_callback;
     ScriptCallback *on_entity_deleted_callback;
@@ -38,6 +38,18 @@ SH_DECL_HOOK2(IGameEventManager2, FireEvent, SH_NOATTRIB, 0, bool, IGameEvent*,
 
 namespace counterstrikesharp {
 
+static uint64_t HashEventName(const char* szName)
+{
+    // FNV-1a, event names are short so this is cheaper than any allocation.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (; *szName; szName++) {
+        hash ^= static_cast<unsigned char>(*szName);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
 EventManager::EventManager() = default;
 
 EventManager::~EventManager() = default;
@@ -69,6 +81,8 @@ void EventManager::OnShutdown()
                    SH_MEMBER(this, &EventManager::OnFireEventPost), true);
 
     globals::gameEventManager->RemoveListener(this);
+
+    FreeUnfiredEvents();
 }
 
 void EventManager::FireGameEvent(IGameEvent* pEvent) {}
@@ -92,7 +106,14 @@ bool EventManager::HookEvent(const char* szName, CallbackT fnCallback, bool bPos
         globals::gameEventManager->AddListener(this, szName, true);
     }
 
-    auto search = m_hooksMap.find(szName);
+    auto nameHash = HashEventName(szName);
+    auto search = m_hooksMap.find(nameHash);
+    if (search != m_hooksMap.end() && search->second->m_Name != szName) {
+        CSSHARP_CORE_ERROR("[EventManager] Event name hash of `{}` collides with `{}`", szName,
+                           search->second->m_Name);
+        return false;
+    }
+
     // If hook struct is not found
     if (search == m_hooksMap.end()) {
         pHook = new EventHook();
@@ -107,7 +128,7 @@ bool EventManager::HookEvent(const char* szName, CallbackT fnCallback, bool bPos
 
         pHook->m_Name = std::string(szName);
 
-        m_hooksMap[szName] = pHook;
+        m_hooksMap[nameHash] = pHook;
 
         return true;
     } else {
@@ -136,13 +157,11 @@ bool EventManager::UnhookEvent(const char* szName, CallbackT fnCallback, bool bP
     EventHook* pHook;
     ScriptCallback* pCallback;
 
-    auto search = m_hooksMap.find(szName);
-    if (search == m_hooksMap.end()) {
+    pHook = FindHook(szName);
+    if (!pHook) {
         return false;
     }
 
-    pHook = search->second;
-
     if (bPost) {
         pCallback = pHook->m_pPostHook;
     } else {
@@ -166,6 +185,77 @@ bool EventManager::UnhookEvent(const char* szName, CallbackT fnCallback, bool bP
     return true;
 }
 
+IGameEvent* EventManager::CreateTrackedEvent(const char* szName, bool bForce)
+{
+    auto pEvent = globals::gameEventManager->CreateEvent(szName, bForce);
+    if (!pEvent) {
+        return nullptr;
+    }
+
+    m_trackedEventIndex[pEvent] = m_trackedEvents.size();
+    m_trackedEvents.push_back(pEvent);
+
+    return pEvent;
+}
+
+bool EventManager::UntrackEvent(IGameEvent* pEvent)
+{
+    auto search = m_trackedEventIndex.find(pEvent);
+    if (search == m_trackedEventIndex.end()) {
+        return false;
+    }
+
+    // Swap-remove, the moved event takes over the freed index.
+    auto index = search->second;
+    m_trackedEventIndex.erase(search);
+
+    auto pLast = m_trackedEvents.back();
+    m_trackedEvents.pop_back();
+    if (pLast != pEvent) {
+        m_trackedEvents[index] = pLast;
+        m_trackedEventIndex[pLast] = index;
+    }
+
+    return true;
+}
+
+void EventManager::FreeUnfiredEvents()
+{
+    if (m_trackedEvents.empty()) {
+        return;
+    }
+
+    CSSHARP_CORE_TRACE("[EventManager] Freeing {} game events that were created but never fired",
+                       m_trackedEvents.size());
+
+    for (auto pEvent : m_trackedEvents) {
+        globals::gameEventManager->FreeEvent(pEvent);
+    }
+
+    m_trackedEvents.clear();
+    m_trackedEventIndex.clear();
+}
+
+EventHook* EventManager::FindHook(const char* szName) const
+{
+    auto search = m_hooksMap.find(HashEventName(szName));
+    if (search == m_hooksMap.end() || search->second->m_Name != szName) {
+        return nullptr;
+    }
+
+    return search->second;
+}
+
+IGameEvent* EventManager::DuplicateForPostHook(EventHook* pHook, IGameEvent* pEvent)
+{
+    // The copy only exists to hand post listeners a live event, skip it when there are none.
+    if (!pHook->m_pPostHook || !pHook->m_pPostHook->HasListeners()) {
+        return nullptr;
+    }
+
+    return globals::gameEventManager->DuplicateEvent(pEvent);
+}
+
 bool EventManager::OnFireEvent(IGameEvent* pEvent, bool bDontBroadcast)
 {
     if (!pEvent) {
@@ -174,10 +264,9 @@ bool EventManager::OnFireEvent(IGameEvent* pEvent, bool bDontBroadcast)
 
     const char* szName = pEvent->GetName();
     bool bLocalDontBroadcast = bDontBroadcast;
-    auto I = m_hooksMap.find(szName);
+    auto pEventHook = FindHook(szName);
 
-    if (I != m_hooksMap.end()) {
-        auto pEventHook = I->second;
+    if (pEventHook) {
         m_EventStack.push(pEventHook);
         auto* pCallback = pEventHook->m_pPreHook;
 
@@ -198,13 +287,13 @@ bool EventManager::OnFireEvent(IGameEvent* pEvent, bool bDontBroadcast)
                 bLocalDontBroadcast = override.m_bDontBroadcast;
 
                 if (result >= HookResult::Handled) {
-                    m_EventCopies.push(globals::gameEventManager->DuplicateEvent(pEvent));
+                    m_EventCopies.push(DuplicateForPostHook(pEventHook, pEvent));
                     globals::gameEventManager->FreeEvent(pEvent);
                     RETURN_META_VALUE(MRES_SUPERCEDE, false);
                 }
             }
         }
-        m_EventCopies.push(globals::gameEventManager->DuplicateEvent(pEvent));
+        m_EventCopies.push(DuplicateForPostHook(pEventHook, pEvent));
     } else {
         m_EventStack.push(nullptr);
     }
@@ -227,9 +316,11 @@ bool EventManager::OnFireEventPost(IGameEvent* pEvent, bool bDontBroadcast)
 
     if (pHook) {
         auto* pCallback = pHook->m_pPostHook;
+        auto pEventCopy = m_EventCopies.top();
+        m_EventCopies.pop();
 
-        if (pCallback) {
-            auto pEventCopy = m_EventCopies.top();
+        // Listeners that hooked post while the pre hooks ran have no copy to look at.
+        if (pCallback && pEventCopy) {
             CSSHARP_CORE_TRACE("Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}",
                               pEventCopy->GetName(), (void*)pEventCopy, bDontBroadcast, true);
             EventOverride override = {bDontBroadcast};
@@ -237,9 +328,10 @@ bool EventManager::OnFireEventPost(IGameEvent* pEvent, bool bDontBroadcast)
             pCallback->ScriptContext().Push(pEventCopy);
             pCallback->ScriptContext().Push(&override);
             pCallback->Execute();
+        }
 
+        if (pEventCopy) {
             globals::gameEventManager->FreeEvent(pEventCopy);
-            m_EventCopies.pop();
         }
     }
 
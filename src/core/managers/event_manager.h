@@ -36,9 +36,11 @@ class CUtlString;
 #include <igameeventsystem.h>
 #include <public/igameevents.h>
 
-#include <map>
+#include <cstdint>
 #include <string>
 #include <stack>
+#include <unordered_map>
+#include <vector>
 
 #include "core/global_listener.h"
 #include "core/globals.h"
@@ -93,15 +95,27 @@ class EventManager : public IGameEventListener2, public GlobalClass
     bool UnhookEvent(const char* szName, CallbackT fnCallback, bool bPost);
     bool HookEvent(const char* szName, CallbackT fnCallback, bool bPost);
 
+    // Events created on behalf of plugins. Anything not fired by the end of the frame is freed.
+    IGameEvent* CreateTrackedEvent(const char* szName, bool bForce);
+    bool UntrackEvent(IGameEvent* pEvent);
+    void FreeUnfiredEvents();
+    size_t GetLiveEventCount() const { return m_trackedEvents.size(); }
+
   private:
     bool OnFireEvent(IGameEvent* pEvent, bool bDontBroadcast);
     bool OnFireEventPost(IGameEvent* pEvent, bool bDontBroadcast);
+    IGameEvent* DuplicateForPostHook(EventHook* pHook, IGameEvent* pEvent);
+    EventHook* FindHook(const char* szName) const;
 
-    std::map<std::string, EventHook*> m_hooksMap;
+    // Keyed by a hash of the event name so OnFireEvent never builds a std::string.
+    std::unordered_map<uint64_t, EventHook*> m_hooksMap;
 
     std::stack<EventHook *> m_EventStack;
     std::stack<IGameEvent *> m_EventCopies;
     std::stack<PendingEventHook> m_PendingHooks;
+
+    std::vector<IGameEvent*> m_trackedEvents;
+    std::unordered_map<IGameEvent*, size_t> m_trackedEventIndex;
 };
 
 } // namespace counterstrikesharp
@@ -137,11 +137,7 @@ bool PlayerManager::OnClientConnect(CPlayerSlot slot, const char* pszName, uint6
 
     pPlayer->Initialize(pszName, pszNetworkID, slot);
 
-    m_on_client_connect_callback->ScriptContext().Reset();
-    m_on_client_connect_callback->ScriptContext().Push(client);
-    m_on_client_connect_callback->ScriptContext().Push(pszName);
-    m_on_client_connect_callback->ScriptContext().Push(pszNetworkID);
-    m_on_client_connect_callback->Execute();
+    m_on_client_connect_callback->Dispatch(client, pszName, pszNetworkID);
 
     if (m_on_client_connect_callback->GetFunctionCount() > 0) {
         //        auto cancel = m_on_client_connect_callback->ScriptContext().GetArgument<bool>(0);
@@ -179,9 +175,7 @@ bool PlayerManager::OnClientConnect_Post(CPlayerSlot slot, const char* pszName,
     CPlayer* pPlayer = &m_players[client];
 
     if (orig_value) {
-        m_on_client_connected_callback->ScriptContext().Reset();
-        m_on_client_connected_callback->ScriptContext().Push(pPlayer->m_slot.Get());
-        m_on_client_connected_callback->Execute();
+        m_on_client_connected_callback->Dispatch(pPlayer->m_slot.Get());
 
         if (!pPlayer->IsFakeClient() && m_is_listen_server &&
             strncmp(pszNetworkID, "127.0.0.1", 9) == 0) {
@@ -212,9 +206,7 @@ void PlayerManager::OnClientPutInServer(CPlayerSlot slot, char const* pszName, i
             return;
         }
 
-        m_on_client_connected_callback->ScriptContext().Reset();
-        m_on_client_connected_callback->ScriptContext().Push(pPlayer->m_slot.Get());
-        m_on_client_connected_callback->Execute();
+        m_on_client_connected_callback->Dispatch(pPlayer->m_slot.Get());
     }
 
     //    if (globals::playerinfoManager != nullptr)
@@ -228,9 +220,7 @@ void PlayerManager::OnClientPutInServer(CPlayerSlot slot, char const* pszName, i
     //    globals::entityListener.HandleEntityCreated(pPlayer->GetBaseEntity(), client);
     //    globals::entityListener.HandleEntitySpawned(pPlayer->GetBaseEntity(), client);
 
-    m_on_client_put_in_server_callback->ScriptContext().Reset();
-    m_on_client_put_in_server_callback->ScriptContext().Push(pPlayer->m_slot.Get());
-    m_on_client_put_in_server_callback->Execute();
+    m_on_client_put_in_server_callback->Dispatch(pPlayer->m_slot.Get());
 }
 
 void PlayerManager::OnClientDisconnect(CPlayerSlot slot, ENetworkDisconnectionReason reason,
@@ -243,10 +233,7 @@ void PlayerManager::OnClientDisconnect(CPlayerSlot slot, ENetworkDisconnectionRe
     CPlayer* pPlayer = &m_players[client];
 
     if (pPlayer->IsConnected()) {
-        m_on_client_disconnect_callback->ScriptContext().Reset();
-        m_on_client_disconnect_callback->ScriptContext().Push(pPlayer->m_slot.Get());
-        m_on_client_disconnect_callback->ScriptContext().Push(reason);
-        m_on_client_disconnect_callback->Execute();
+        m_on_client_disconnect_callback->Dispatch(pPlayer->m_slot.Get(), reason);
     }
 
     if (pPlayer->WasCountedAsInGame()) {
@@ -272,19 +259,14 @@ void PlayerManager::OnClientDisconnect_Post(CPlayerSlot slot, ENetworkDisconnect
 
     InvalidatePlayer(pPlayer);
 
-    m_on_client_disconnect_post_callback->ScriptContext().Reset();
-    m_on_client_disconnect_post_callback->ScriptContext().Push(pPlayer->m_slot.Get());
-    m_on_client_disconnect_post_callback->ScriptContext().Push(reason);
-    m_on_client_disconnect_post_callback->Execute();
+    m_on_client_disconnect_post_callback->Dispatch(pPlayer->m_slot.Get(), reason);
 }
 
 void PlayerManager::OnClientVoice(CPlayerSlot slot) const
 {
     CSSHARP_CORE_TRACE("[PlayerManager][OnClientVoice] - {}", slot.Get());
 
-    m_on_client_voice_callback->ScriptContext().Reset();
-    m_on_client_voice_callback->ScriptContext().Push(slot.Get());
-    m_on_client_voice_callback->Execute();
+    m_on_client_voice_callback->Dispatch(slot.Get());
 }
 
 void PlayerManager::OnLevelEnd()
@@ -482,10 +464,7 @@ void PlayerManager::OnAuthorized(CPlayer* player) const
     CSSHARP_CORE_TRACE("[PlayerManager][OnAuthorized] - {} {}", player->GetName(),
                        player->GetSteamId()->ConvertToUint64());
 
-    m_on_client_authorized_callback->ScriptContext().Reset();
-    m_on_client_authorized_callback->ScriptContext().Push(player->m_slot.Get());
-    m_on_client_authorized_callback->ScriptContext().Push(player->GetSteamId()->ConvertToUint64());
-    m_on_client_authorized_callback->Execute();
+    m_on_client_authorized_callback->Dispatch(player->m_slot.Get(), player->GetSteamId()->ConvertToUint64());
 }
 
 bool CPlayer::WasCountedAsInGame() const { return m_is_in_game; }
@@ -99,10 +99,8 @@ void ServerManager::ServerHibernationUpdate(bool bHibernating)
 
     auto callback = globals::serverManager.on_server_hibernation_update_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(bHibernating);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(bHibernating);
     }
 }
 
@@ -112,9 +110,8 @@ void ServerManager::GameServerSteamAPIActivated()
 
     auto callback = globals::serverManager.on_server_steam_api_activated_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch();
     }
 }
 
@@ -124,9 +121,8 @@ void ServerManager::GameServerSteamAPIDeactivated()
 
     auto callback = globals::serverManager.on_server_steam_api_deactivated_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch();
     }
 }
 
@@ -136,10 +132,8 @@ void ServerManager::OnHostNameChanged(const char *pHostname)
 
     auto callback = globals::serverManager.on_server_hostname_changed_callback;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(pHostname);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(pHostname);
     }
 }
 
@@ -149,9 +143,8 @@ void ServerManager::PreFatalShutdown()
 
     auto callback = globals::serverManager.on_server_pre_fatal_shutdown;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch();
     }
 }
 
@@ -161,10 +154,8 @@ void ServerManager::UpdateWhenNotInGame(float flFrameTime)
 
     auto callback = globals::serverManager.on_server_update_when_not_in_game;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(flFrameTime);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(flFrameTime);
     }
 }
 
@@ -185,10 +176,8 @@ void ServerManager::PreWorldUpdate(bool bSimulating)
 
     auto callback = globals::serverManager.on_server_pre_world_update;
 
-    if (callback && callback->GetFunctionCount()) {
-        callback->ScriptContext().Reset();
-        callback->ScriptContext().Push(bSimulating);
-        callback->Execute();
+    if (callback) {
+        callback->Dispatch(bSimulating);
     }
 }
 
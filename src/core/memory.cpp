@@ -25,6 +25,7 @@
 #include <dlfcn.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/stat.h>
 #else
 #include <Windows.h>
 #include <Psapi.h>
@@ -35,6 +36,8 @@
 #include "memory_module.h"
 #include "metamod_oslink.h"
 #include "wchartypes.h"
+#include "core/globals.h"
+#include "core/signature_cache.h"
 
 #if __linux__
 struct ModuleInfo {
@@ -116,6 +119,69 @@ int GetModuleInformation(void *hModule, void **base, size_t *length) {
 
     return 0;
 }
+
+uint64_t GetModuleBuildId(void *hModule) {
+    struct link_map *dlmap = (struct link_map *)hModule;
+    Dl_info info;
+
+    if (!dladdr((void *)dlmap->l_addr, &info) || !info.dli_fbase) {
+        return 0;
+    }
+
+    uintptr_t baseAddr = reinterpret_cast<uintptr_t>(info.dli_fbase);
+    auto file = reinterpret_cast<Elf64_Ehdr *>(baseAddr);
+    auto phdr = reinterpret_cast<Elf64_Phdr *>(baseAddr + file->e_phoff);
+
+    /* Prefer the linker generated NT_GNU_BUILD_ID note */
+    for (uint16_t i = 0; i < file->e_phnum; i++) {
+        if (phdr[i].p_type != PT_NOTE) {
+            continue;
+        }
+
+        uintptr_t note = baseAddr + phdr[i].p_vaddr;
+        uintptr_t noteEnd = note + phdr[i].p_memsz;
+
+        while (note + sizeof(Elf64_Nhdr) <= noteEnd) {
+            auto nhdr = reinterpret_cast<Elf64_Nhdr *>(note);
+            uintptr_t name = note + sizeof(Elf64_Nhdr);
+            uintptr_t desc = name + ((nhdr->n_namesz + 3) & ~3);
+            uintptr_t next = desc + ((nhdr->n_descsz + 3) & ~3);
+
+            if (next > noteEnd) {
+                break;
+            }
+
+            if (nhdr->n_type == NT_GNU_BUILD_ID && nhdr->n_namesz == 4 && memcmp((void *)name, "GNU", 4) == 0) {
+                return counterstrikesharp::CSignatureCache::Hash((void *)desc, nhdr->n_descsz);
+            }
+
+            note = next;
+        }
+    }
+
+    /* No build id, fall back to the file size, mtime and the loaded headers */
+    struct stat st;
+    if (!info.dli_fname || stat(info.dli_fname, &st) != 0) {
+        return 0;
+    }
+
+    uint64_t hash = counterstrikesharp::CSignatureCache::Hash(&st.st_size, sizeof(st.st_size));
+    hash = counterstrikesharp::CSignatureCache::Hash(&st.st_mtime, sizeof(st.st_mtime), hash);
+    return counterstrikesharp::CSignatureCache::Hash(phdr, sizeof(Elf64_Phdr) * file->e_phnum, hash);
+}
+#else
+uint64_t GetModuleBuildId(void *hModule) {
+    auto baseAddr = reinterpret_cast<uintptr_t>(hModule);
+    auto dos = reinterpret_cast<IMAGE_DOS_HEADER *>(baseAddr);
+    auto nt = reinterpret_cast<IMAGE_NT_HEADERS *>(baseAddr + dos->e_lfanew);
+
+    uint64_t hash = counterstrikesharp::CSignatureCache::Hash(&nt->FileHeader.TimeDateStamp,
+                                                              sizeof(nt->FileHeader.TimeDateStamp));
+    hash = counterstrikesharp::CSignatureCache::Hash(&nt->OptionalHeader.SizeOfImage,
+                                                     sizeof(nt->OptionalHeader.SizeOfImage), hash);
+    return counterstrikesharp::CSignatureCache::Hash(&nt->OptionalHeader.CheckSum,
+                                                     sizeof(nt->OptionalHeader.CheckSum), hash);
+}
 #endif
 
 byte *ConvertToByteArray(const char *str, size_t *outLength) {
@@ -134,6 +200,8 @@ byte *ConvertToByteArray(const char *str, size_t *outLength) {
 void* FindSignature(const char* moduleName, const char* bytesStr) {
     size_t iSigLength;
     auto sigBytes = ConvertToByteArray(bytesStr, &iSigLength);
+    counterstrikesharp::modules::CSignature signature(sigBytes, iSigLength);
+    free(sigBytes);
 
     auto module = dlmount(moduleName);
     if (module == nullptr) {
@@ -154,24 +222,13 @@ void* FindSignature(const char* moduleName, const char* bytesStr) {
     moduleSize = m_hModuleInfo.SizeOfImage;
 #endif
 
-    unsigned char *pMemory;
-    void *returnAddr = nullptr;
+    auto moduleKey = counterstrikesharp::CSignatureCache::Hash(moduleName, strlen(moduleName));
+    auto buildKey = GetModuleBuildId(module);
 
-    pMemory = (byte *)moduleBase;
-
-    for (size_t i = 0; i < moduleSize; i++) {
-        size_t matches = 0;
-        while (*(pMemory + i + matches) == sigBytes[matches] || sigBytes[matches] == '\x2A') {
-            matches++;
-            if (matches == iSigLength) {
-                returnAddr = (void *)(pMemory + i);
-            }
-        }
-    }
-
-    if (returnAddr == nullptr) {
-        return nullptr;
-    }
+    // Same as CModule, so entries of a previous build of this module are pruned on save.
+    if (counterstrikesharp::globals::signatureCache && buildKey)
+        counterstrikesharp::globals::signatureCache->RegisterModule(moduleKey, buildKey);
 
-    return returnAddr;
+    return counterstrikesharp::modules::FindSignatureInImage((const byte *)moduleBase, moduleSize, moduleKey,
+                                                             buildKey, signature);
 }
\ No newline at end of file
@@ -12,7 +12,11 @@
 #define MODULE_EXT ".so"
 #endif
 
+#include <cstdint>
+
 #if __linux__
 int GetModuleInformation(void *hModule, void **base, size_t *length);
 #endif
+// Identifies the exact binary of a loaded module, 0 if it cannot be determined.
+uint64_t GetModuleBuildId(void *hModule);
 void* FindSignature(const char* moduleName, const char* bytesStr);
@@ -4,13 +4,131 @@
 #include <Psapi.h>
 #endif
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CSSHARP_SCAN_SSE2 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 #include "dbg.h"
 #include "core/gameconfig.h"
 #include "core/memory.h"
+#include "core/signature_cache.h"
 #include "metamod_oslink.h"
 
 namespace counterstrikesharp::modules {
 
+static constexpr byte kWildcard = '\x2A';
+
+CSignature::CSignature(const byte* pData, size_t iLength)
+    : m_bytes(pData, pData + iLength), m_hash(CSignatureCache::Hash(pData, iLength))
+{
+    for (size_t i = 0; i < iLength;) {
+        if (pData[i] == kWildcard) {
+            i++;
+            continue;
+        }
+
+        size_t runStart = i;
+        while (i < iLength && pData[i] != kWildcard)
+            i++;
+
+        if (i - runStart > m_anchorLength) {
+            m_anchorOffset = runStart;
+            m_anchorLength = i - runStart;
+        }
+    }
+}
+
+bool CSignature::AnchorMatchesAt(const byte* pAnchor) const
+{
+    return memcmp(pAnchor, m_bytes.data() + m_anchorOffset, m_anchorLength) == 0;
+}
+
+bool CSignature::MatchesAt(const byte* pStart) const
+{
+    for (size_t i = 0; i < m_bytes.size(); i++) {
+        if (m_bytes[i] != kWildcard && pStart[i] != m_bytes[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Next position in [pos, last) whose first two bytes equal first/second. pos[1] must be readable
+// for every candidate, which holds because anchors of two or more bytes are checked here.
+static const byte* FindBytePair(const byte* pos, const byte* last, byte first, byte second)
+{
+#ifdef CSSHARP_SCAN_SSE2
+    auto lowestSetBit = [](int mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    };
+
+    const __m128i firstMask = _mm_set1_epi8(static_cast<char>(first));
+    const __m128i secondMask = _mm_set1_epi8(static_cast<char>(second));
+
+    while (last - pos >= 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos + 1));
+        int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, firstMask), _mm_cmpeq_epi8(b, secondMask)));
+
+        if (mask != 0)
+            return pos + lowestSetBit(mask);
+
+        pos += 16;
+    }
+#endif
+
+    for (; pos < last; pos++) {
+        if (pos[0] == first && pos[1] == second)
+            return pos;
+    }
+
+    return nullptr;
+}
+
+const byte* CSignature::Find(const byte* begin, const byte* end) const
+{
+    if (!IsValid() || begin > end || static_cast<size_t>(end - begin) < m_bytes.size())
+        return nullptr;
+
+    // Anchor positions for which the whole signature still fits inside [begin, end).
+    const byte* pos = begin + m_anchorOffset;
+    const byte* last = end - m_bytes.size() + m_anchorOffset + 1;
+    const byte first = m_bytes[m_anchorOffset];
+
+    while (pos < last) {
+        const byte* pAnchor;
+        if (m_anchorLength == 1) {
+            pAnchor = static_cast<const byte*>(memchr(pos, first, last - pos));
+        } else {
+            pAnchor = FindBytePair(pos, last, first, m_bytes[m_anchorOffset + 1]);
+        }
+
+        if (!pAnchor)
+            return nullptr;
+
+        if (AnchorMatchesAt(pAnchor) && MatchesAt(pAnchor - m_anchorOffset))
+            return pAnchor - m_anchorOffset;
+
+        pos = pAnchor + 1;
+    }
+
+    return nullptr;
+}
+
 CModule::CModule(const char* path, const char* module) : m_pszModule(module), m_pszPath(path)
 {
     char szModule[MAX_PATH];
@@ -33,6 +151,32 @@ CModule::CModule(const char* path, const char* module) : m_pszModule(module), m_
     if (int e = GetModuleInformation(m_hModule, &m_base, &m_size))
         Error("Failed to get module info for %s, error %d\n", szModule, e);
 #endif
+
+    m_moduleKey = CSignatureCache::Hash(m_pszModule, strlen(m_pszModule));
+    m_buildKey = GetModuleBuildId(m_hModule);
+
+    if (globals::signatureCache && m_buildKey)
+        globals::signatureCache->RegisterModule(m_moduleKey, m_buildKey);
+}
+
+const byte* FindSignatureInImage(const byte* pBase, size_t iSize, uint64_t iModuleKey, uint64_t iBuildKey,
+                                 const CSignature& signature)
+{
+    auto* cache = iBuildKey ? globals::signatureCache : nullptr;
+
+    uint64_t rva;
+    if (cache && cache->Lookup(iBuildKey, signature.Hash(), rva)) {
+        // Trust but verify, a hash collision must never hand out a wrong address.
+        if (rva <= iSize && signature.Length() <= iSize - rva && signature.MatchesAt(pBase + rva))
+            return pBase + rva;
+    }
+
+    const byte* pFound = signature.Find(pBase, pBase + iSize);
+
+    if (cache && pFound)
+        cache->Store(iModuleKey, iBuildKey, signature.Hash(), static_cast<uint64_t>(pFound - pBase));
+
+    return pFound;
 }
 
 void* CModule::FindSignature(const char* signature)
@@ -43,27 +187,136 @@ void* CModule::FindSignature(const char* signature)
 
     size_t iSigLength = 0;
     byte* pData = CGameConfig::HexToByte(signature, iSigLength);
+    if (!pData) {
+        return nullptr;
+    }
+
+    void* address = this->FindSignature(pData, iSigLength);
+    delete[] pData;
 
-    return this->FindSignature(pData, iSigLength);
+    return address;
 }
 
 void* CModule::FindSignature(const byte* pData, size_t iSigLength)
 {
-    unsigned char* pMemory;
-    void* return_addr = nullptr;
+    return this->FindSignature(CSignature(pData, iSigLength));
+}
+
+void* CModule::FindSignature(const CSignature& signature)
+{
+    return (void*)FindSignatureInImage(static_cast<const byte*>(m_base), m_size, m_moduleKey, m_buildKey, signature);
+}
+
+bool CModule::FindCachedSignature(const CSignature& signature, void*& address) const
+{
+    auto* cache = m_buildKey ? globals::signatureCache : nullptr;
+    const byte* pBegin = static_cast<const byte*>(m_base);
 
-    pMemory = (byte*)m_base;
+    uint64_t rva;
+    if (!cache || !cache->Lookup(m_buildKey, signature.Hash(), rva))
+        return false;
+
+    if (rva <= m_size && signature.Length() <= m_size - rva && signature.MatchesAt(pBegin + rva)) {
+        address = (void*)(pBegin + rva);
+        return true;
+    }
+
+    return false;
+}
+
+void CModule::CacheSignature(const CSignature& signature, void* address) const
+{
+    if (!m_buildKey || !globals::signatureCache || !address)
+        return;
 
-    for (size_t i = 0; i < m_size; i++) {
-        size_t Matches = 0;
-        while (*(pMemory + i + Matches) == pData[Matches] || pData[Matches] == '\x2A') {
-            Matches++;
-            if (Matches == iSigLength)
-                return_addr = (void*)(pMemory + i);
+    auto rva = static_cast<uint64_t>(static_cast<const byte*>(address) - static_cast<const byte*>(m_base));
+    globals::signatureCache->Store(m_moduleKey, m_buildKey, signature.Hash(), rva);
+}
+
+void CModule::FindSignatures(const std::vector<const CSignature*>& signatures, std::vector<void*>& results)
+{
+    results.assign(signatures.size(), nullptr);
+
+    std::vector<const CSignature*> pending;
+    std::vector<size_t> pendingIndices;
+    for (size_t i = 0; i < signatures.size(); i++) {
+        if (signatures[i] && !FindCachedSignature(*signatures[i], results[i])) {
+            pending.push_back(signatures[i]);
+            pendingIndices.push_back(i);
         }
     }
 
-    return return_addr;
+    if (pending.empty())
+        return;
+
+    std::vector<void*> found;
+    ScanSignatures(pending, 0, m_size, found);
+
+    for (size_t i = 0; i < pending.size(); i++) {
+        results[pendingIndices[i]] = found[i];
+        if (pending[i]->IsValid())
+            CacheSignature(*pending[i], found[i]);
+    }
+}
+
+void CModule::ScanSignatures(const std::vector<const CSignature*>& signatures, size_t rangeBegin, size_t rangeEnd,
+                             std::vector<void*>& results) const
+{
+    results.assign(signatures.size(), nullptr);
+
+    const byte* pBegin = static_cast<const byte*>(m_base);
+    const byte* pEnd = pBegin + m_size;
+    const byte* pRangeBegin = pBegin + std::min(rangeBegin, m_size);
+    const byte* pRangeEnd = pBegin + std::min(rangeEnd, m_size);
+
+    // Bucket the signatures by the first byte of their anchor so each module byte costs a
+    // single table lookup, then confirm the anchor and full pattern for the few candidates.
+    std::array<std::vector<size_t>, 256> buckets;
+    size_t pending = 0;
+    size_t maxAnchorOffset = 0;
+    for (size_t i = 0; i < signatures.size(); i++) {
+        if (!signatures[i] || !signatures[i]->IsValid())
+            continue;
+
+        buckets[signatures[i]->AnchorByte()].push_back(i);
+        maxAnchorOffset = std::max(maxAnchorOffset, signatures[i]->AnchorOffset());
+        pending++;
+    }
+
+    // Anchors of matches starting near the end of the range lie past it.
+    const byte* pScanEnd = static_cast<size_t>(pEnd - pRangeEnd) > maxAnchorOffset ? pRangeEnd + maxAnchorOffset : pEnd;
+
+    for (const byte* pos = pRangeBegin; pos < pScanEnd && pending > 0; pos++) {
+        auto& bucket = buckets[*pos];
+        if (bucket.empty())
+            continue;
+
+        for (size_t b = 0; b < bucket.size();) {
+            const CSignature& signature = *signatures[bucket[b]];
+
+            if (static_cast<size_t>(pos - pRangeBegin) < signature.AnchorOffset() ||
+                static_cast<size_t>(pEnd - pos) < signature.Length() - signature.AnchorOffset()) {
+                b++;
+                continue;
+            }
+
+            const byte* pStart = pos - signature.AnchorOffset();
+            if (pStart >= pRangeEnd) {
+                b++;
+                continue;
+            }
+
+            if (signature.AnchorMatchesAt(pos) && signature.MatchesAt(pStart)) {
+                results[bucket[b]] = (void*)pStart;
+                bucket[b] = bucket.back();
+                bucket.pop_back();
+                pending--;
+                continue;
+            }
+
+            b++;
+        }
+    }
 }
 
 void* CModule::FindInterface(const char* name)
@@ -19,6 +19,7 @@
 
 #pragma once
 #include <cstdio>
+#include <vector>
 
 #include "interface.h"
 #include "strtools.h"
@@ -27,6 +28,36 @@
 
 namespace counterstrikesharp::modules {
 
+/**
+ * A byte signature compiled for scanning. '\x2A' bytes are wildcards. The longest run of
+ * solid bytes is used as the anchor that candidate positions are filtered on.
+ */
+class CSignature
+{
+  public:
+    CSignature(const byte* pData, size_t iLength);
+
+    bool IsValid() const { return m_anchorLength > 0; }
+    size_t Length() const { return m_bytes.size(); }
+    uint64_t Hash() const { return m_hash; }
+
+    // Returns the first match in [begin, end), never reading outside of the range.
+    const byte* Find(const byte* begin, const byte* end) const;
+
+    bool MatchesAt(const byte* pStart) const;
+    bool AnchorMatchesAt(const byte* pAnchor) const;
+
+    size_t AnchorOffset() const { return m_anchorOffset; }
+    byte AnchorByte() const { return m_bytes[m_anchorOffset]; }
+
+  private:
+
+    std::vector<byte> m_bytes;
+    uint64_t m_hash = 0;
+    size_t m_anchorOffset = 0;
+    size_t m_anchorLength = 0;
+};
+
 class CModule
 {
   public:
@@ -36,6 +67,20 @@ class CModule
 
     void* FindSignature(const byte* pData, size_t iSigLength);
 
+    void* FindSignature(const CSignature& signature);
+
+    // Resolves every signature in a single pass over the module, results[i] is null if not found.
+    void FindSignatures(const std::vector<const CSignature*>& signatures, std::vector<void*>& results);
+
+    // Finds the first match of each signature that starts within [rangeBegin, rangeEnd) of the
+    // module, without touching the signature cache. Safe to call from several threads at once.
+    void ScanSignatures(const std::vector<const CSignature*>& signatures, size_t rangeBegin, size_t rangeEnd,
+                        std::vector<void*>& results) const;
+
+    // True if the signature cache has a verified address for this build.
+    bool FindCachedSignature(const CSignature& signature, void*& address) const;
+    void CacheSignature(const CSignature& signature, void* address) const;
+
     void* FindInterface(const char* name);
 
     const char* m_pszModule;
@@ -43,6 +88,12 @@ class CModule
     HINSTANCE m_hModule;
     void* m_base;
     size_t m_size;
+    uint64_t m_moduleKey;
+    uint64_t m_buildKey;
 };
 
+// Finds a signature in a loaded image, going through the signature cache when the build is known.
+const byte* FindSignatureInImage(const byte* pBase, size_t iSize, uint64_t iModuleKey, uint64_t iBuildKey,
+                                 const CSignature& signature);
+
 } // namespace counterstrikesharp::modules
\ No newline at end of file
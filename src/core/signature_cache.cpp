@@ -0,0 +1,284 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/signature_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
+#include "core/log.h"
+
+namespace counterstrikesharp {
+
+namespace {
+constexpr char kCacheMagic[8] = {'C', 'S', 'S', 'S', 'I', 'G', 'S', '\0'};
+constexpr uint32_t kCacheVersion = 1;
+
+struct SignatureCacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t entrySize;
+    uint64_t entryCount;
+};
+
+bool EntryLess(const SignatureCacheEntry& a, const SignatureCacheEntry& b)
+{
+    return a.buildKey != b.buildKey ? a.buildKey < b.buildKey : a.signatureKey < b.signatureKey;
+}
+
+// Lookups binary search the table, so it has to be strictly sorted to be usable at all.
+bool IsWellFormed(const SignatureCacheEntry* pEntries, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (pEntries[i].buildKey == 0 || (i > 0 && !EntryLess(pEntries[i - 1], pEntries[i]))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int CurrentProcessId()
+{
+#if __linux__
+    return getpid();
+#else
+    return _getpid();
+#endif
+}
+} // namespace
+
+CSignatureCache::CSignatureCache(const std::string& path) : m_sPath(path) {}
+
+CSignatureCache::~CSignatureCache() { Unmap(); }
+
+uint64_t CSignatureCache::Hash(const void* pData, size_t iLength, uint64_t seed)
+{
+    auto bytes = static_cast<const uint8_t*>(pData);
+    uint64_t hash = seed;
+
+    for (size_t i = 0; i < iLength; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+void CSignatureCache::Unmap()
+{
+#if __linux__
+    if (m_pMapping) {
+        munmap(m_pMapping, m_iMappingSize);
+    }
+#endif
+    m_pMapping = nullptr;
+    m_iMappingSize = 0;
+    m_buffer.clear();
+    m_pEntries = nullptr;
+    m_iEntryCount = 0;
+}
+
+void CSignatureCache::Load()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    Unmap();
+
+    const char* data = nullptr;
+    size_t size = 0;
+
+#if __linux__
+    int fd = open(m_sPath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            m_pMapping = mapping;
+            m_iMappingSize = st.st_size;
+            data = static_cast<const char*>(mapping);
+            size = m_iMappingSize;
+        }
+    }
+    close(fd);
+#else
+    std::ifstream ifs(m_sPath, std::ios::binary);
+    if (!ifs) {
+        return;
+    }
+
+    m_buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    data = m_buffer.data();
+    size = m_buffer.size();
+#endif
+
+    if (!data || size < sizeof(SignatureCacheHeader)) {
+        Unmap();
+        return;
+    }
+
+    auto header = reinterpret_cast<const SignatureCacheHeader*>(data);
+    if (memcmp(header->magic, kCacheMagic, sizeof(kCacheMagic)) != 0 || header->version != kCacheVersion ||
+        header->entrySize != sizeof(SignatureCacheEntry) ||
+        header->entryCount > (size - sizeof(SignatureCacheHeader)) / sizeof(SignatureCacheEntry)) {
+        CSSHARP_CORE_WARN("Ignoring invalid signature cache '{}'", m_sPath);
+        Unmap();
+        return;
+    }
+
+    auto pEntries = reinterpret_cast<const SignatureCacheEntry*>(data + sizeof(SignatureCacheHeader));
+    if (!IsWellFormed(pEntries, header->entryCount)) {
+        CSSHARP_CORE_WARN("Ignoring corrupt signature cache '{}'", m_sPath);
+        Unmap();
+        return;
+    }
+
+    m_pEntries = pEntries;
+    m_iEntryCount = header->entryCount;
+
+    CSSHARP_CORE_INFO("Loaded {} cached signatures from '{}'", m_iEntryCount, m_sPath);
+}
+
+void CSignatureCache::RegisterModule(uint64_t moduleKey, uint64_t buildKey)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_currentBuilds[moduleKey] = buildKey;
+}
+
+bool CSignatureCache::Lookup(uint64_t buildKey, uint64_t signatureKey, uint64_t& rva)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    if (auto it = m_added.find({buildKey, signatureKey}); it != m_added.end()) {
+        rva = it->second.rva;
+        return rva != kNotFound;
+    }
+
+    SignatureCacheEntry key{0, buildKey, signatureKey, 0};
+    auto end = m_pEntries + m_iEntryCount;
+    auto it = std::lower_bound(m_pEntries, end, key, EntryLess);
+    if (it == end || it->buildKey != buildKey || it->signatureKey != signatureKey || it->rva == kNotFound) {
+        return false;
+    }
+
+    rva = it->rva;
+    return true;
+}
+
+void CSignatureCache::Store(uint64_t moduleKey, uint64_t buildKey, uint64_t signatureKey, uint64_t rva)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_added[{buildKey, signatureKey}] = {moduleKey, buildKey, signatureKey, rva};
+}
+
+bool CSignatureCache::Save()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    if (m_added.empty()) {
+        return true;
+    }
+
+    std::vector<SignatureCacheEntry> entries;
+    entries.reserve(m_iEntryCount + m_added.size());
+
+    for (size_t i = 0; i < m_iEntryCount; i++) {
+        const auto& entry = m_pEntries[i];
+
+        // Drop entries for a module whose binary has changed since they were written.
+        auto current = m_currentBuilds.find(entry.moduleKey);
+        if (current != m_currentBuilds.end() && current->second != entry.buildKey) {
+            continue;
+        }
+
+        if (entry.rva == kNotFound || m_added.count({entry.buildKey, entry.signatureKey})) {
+            continue;
+        }
+
+        entries.push_back(entry);
+    }
+
+    for (const auto& [key, entry] : m_added) {
+        if (entry.rva != kNotFound) {
+            entries.push_back(entry);
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), EntryLess);
+
+    SignatureCacheHeader header{};
+    memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.version = kCacheVersion;
+    header.entrySize = sizeof(SignatureCacheEntry);
+    header.entryCount = entries.size();
+
+    std::error_code ec;
+
+    // Servers sharing an install save to the same cache, each writes its own temp file so a
+    // rename only ever moves a complete table into place.
+    auto tempPath = m_sPath + "." + std::to_string(CurrentProcessId()) + ".tmp";
+    {
+        std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            CSSHARP_CORE_WARN("Could not write signature cache '{}'", tempPath);
+            return false;
+        }
+
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(SignatureCacheEntry));
+        if (!ofs) {
+            CSSHARP_CORE_WARN("Could not write signature cache '{}'", tempPath);
+            ofs.close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    // Replaced atomically, so a crash mid-write never leaves a truncated cache behind.
+    std::filesystem::rename(tempPath, m_sPath, ec);
+    if (ec) {
+        CSSHARP_CORE_WARN("Could not replace signature cache '{}': {}", m_sPath, ec.message());
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+
+    // The mapped view still points at the previous file, keep serving from what we merged.
+    Unmap();
+    m_buffer.resize(sizeof(SignatureCacheEntry) * entries.size());
+    memcpy(m_buffer.data(), entries.data(), m_buffer.size());
+    m_pEntries = reinterpret_cast<const SignatureCacheEntry*>(m_buffer.data());
+    m_iEntryCount = entries.size();
+    m_added.clear();
+
+    return true;
+}
+
+} // namespace counterstrikesharp
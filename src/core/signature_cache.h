@@ -0,0 +1,81 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace counterstrikesharp {
+
+struct SignatureCacheEntry
+{
+    uint64_t moduleKey;    // hash of the module name, used to drop entries of outdated builds
+    uint64_t buildKey;     // module build identity, see GetModuleBuildId
+    uint64_t signatureKey; // hash of the signature bytes
+    uint64_t rva;          // offset from the module base
+};
+
+/**
+ * On-disk cache of resolved signature offsets. The file is memory-mapped and looked up in
+ * place; entries resolved during this session are kept aside and merged in on Save().
+ * Entries are keyed by module build identity, so a changed binary simply never hits and its
+ * old entries are dropped the next time the cache is saved. Only hits are cached, a signature
+ * that was not found is scanned for again on every start.
+ */
+class CSignatureCache
+{
+  public:
+    // Marked misses in earlier cache files, such entries are ignored and dropped on Save().
+    static constexpr uint64_t kNotFound = ~0ull;
+
+    explicit CSignatureCache(const std::string& path);
+    ~CSignatureCache();
+
+    void Load();
+    bool Save();
+
+    // Records the build currently loaded for a module so entries of other builds get pruned.
+    void RegisterModule(uint64_t moduleKey, uint64_t buildKey);
+
+    bool Lookup(uint64_t buildKey, uint64_t signatureKey, uint64_t& rva);
+    void Store(uint64_t moduleKey, uint64_t buildKey, uint64_t signatureKey, uint64_t rva);
+
+    static uint64_t Hash(const void* pData, size_t iLength, uint64_t seed = 0xcbf29ce484222325);
+
+  private:
+    void Unmap();
+
+    std::string m_sPath;
+    std::mutex m_lock;
+
+    const SignatureCacheEntry* m_pEntries = nullptr;
+    size_t m_iEntryCount = 0;
+    void* m_pMapping = nullptr;
+    size_t m_iMappingSize = 0;
+    std::vector<char> m_buffer;
+
+    std::map<std::pair<uint64_t, uint64_t>, SignatureCacheEntry> m_added;
+    std::unordered_map<uint64_t, uint64_t> m_currentBuilds;
+};
+
+} // namespace counterstrikesharp
@@ -0,0 +1,235 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace counterstrikesharp {
+
+SpatialGrid::SpatialGrid(float cellSize) : m_cellSize(cellSize), m_inverseCellSize(1.0f / cellSize)
+{
+    Clear();
+}
+
+void SpatialGrid::Clear()
+{
+    m_entries.clear();
+    m_sorted.clear();
+    m_cells.clear();
+    m_boundsMin = Vector(0, 0, 0);
+    m_boundsMax = Vector(0, 0, 0);
+}
+
+void SpatialGrid::Add(const Vector& origin, uint32_t handle, const void* pTag)
+{
+    // NaN origins would poison the cell math, such entities are simply not indexed.
+    if (!std::isfinite(origin.x) || !std::isfinite(origin.y) || !std::isfinite(origin.z)) {
+        return;
+    }
+
+    m_entries.push_back(Entry{origin, handle, pTag});
+}
+
+int32_t SpatialGrid::CellCoord(float value) const
+{
+    return static_cast<int32_t>(std::floor(value * m_inverseCellSize));
+}
+
+uint64_t SpatialGrid::CellKey(int32_t x, int32_t y) const
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+void SpatialGrid::Build()
+{
+    m_sorted.clear();
+    m_cells.clear();
+
+    if (m_entries.empty()) {
+        return;
+    }
+
+    m_boundsMin = m_boundsMax = m_entries[0].m_origin;
+    m_entryKeys.resize(m_entries.size());
+    m_order.resize(m_entries.size());
+
+    for (uint32_t i = 0; i < m_entries.size(); i++) {
+        const auto& origin = m_entries[i].m_origin;
+
+        m_boundsMin.x = std::min(m_boundsMin.x, origin.x);
+        m_boundsMin.y = std::min(m_boundsMin.y, origin.y);
+        m_boundsMin.z = std::min(m_boundsMin.z, origin.z);
+        m_boundsMax.x = std::max(m_boundsMax.x, origin.x);
+        m_boundsMax.y = std::max(m_boundsMax.y, origin.y);
+        m_boundsMax.z = std::max(m_boundsMax.z, origin.z);
+
+        m_entryKeys[i] = CellKey(CellCoord(origin.x), CellCoord(origin.y));
+        m_order[i] = i;
+    }
+
+    std::sort(m_order.begin(), m_order.end(),
+              [this](uint32_t a, uint32_t b) { return m_entryKeys[a] < m_entryKeys[b]; });
+
+    m_sorted.reserve(m_entries.size());
+    for (uint32_t i = 0; i < m_order.size(); i++) {
+        auto key = m_entryKeys[m_order[i]];
+        m_sorted.push_back(m_entries[m_order[i]]);
+
+        auto [cell, inserted] = m_cells.try_emplace(key, CellRange{i, i + 1});
+        if (!inserted) {
+            cell->second.m_end = i + 1;
+        }
+    }
+}
+
+template <typename Visitor>
+void SpatialGrid::VisitCells(float minX, float minY, float maxX, float maxY, Visitor&& visitor) const
+{
+    // Clamp to what is actually populated, so huge query volumes stay bounded.
+    minX = std::max(minX, m_boundsMin.x);
+    minY = std::max(minY, m_boundsMin.y);
+    maxX = std::min(maxX, m_boundsMax.x);
+    maxY = std::min(maxY, m_boundsMax.y);
+
+    // Written negated so NaN bounds are rejected too, they have no cell.
+    if (m_sorted.empty() || !(minX <= maxX) || !(minY <= maxY)) {
+        return;
+    }
+
+    auto cellMinX = CellCoord(minX), cellMaxX = CellCoord(maxX);
+    auto cellMinY = CellCoord(minY), cellMaxY = CellCoord(maxY);
+
+    for (auto x = cellMinX; x <= cellMaxX; x++) {
+        for (auto y = cellMinY; y <= cellMaxY; y++) {
+            auto search = m_cells.find(CellKey(x, y));
+            if (search == m_cells.end()) {
+                continue;
+            }
+
+            for (auto i = search->second.m_begin; i < search->second.m_end; i++) {
+                visitor(m_sorted[i]);
+            }
+        }
+    }
+}
+
+int SpatialGrid::QueryRadius(const Vector& center, float radius, const void* pTag,
+                             uint32_t* pHandles, int capacity) const
+{
+    int total = 0;
+    const float radiusSq = radius * radius;
+
+    VisitCells(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+               [&](const Entry& entry) {
+                   if (pTag && entry.m_pTag != pTag) {
+                       return;
+                   }
+
+                   if ((entry.m_origin - center).LengthSqr() > radiusSq) {
+                       return;
+                   }
+
+                   if (total < capacity) {
+                       pHandles[total] = entry.m_handle;
+                   }
+                   total++;
+               });
+
+    return total;
+}
+
+int SpatialGrid::QueryBox(const Vector& mins, const Vector& maxs, const void* pTag,
+                          uint32_t* pHandles, int capacity) const
+{
+    int total = 0;
+
+    VisitCells(mins.x, mins.y, maxs.x, maxs.y, [&](const Entry& entry) {
+        if (pTag && entry.m_pTag != pTag) {
+            return;
+        }
+
+        const auto& origin = entry.m_origin;
+        if (origin.x < mins.x || origin.y < mins.y || origin.z < mins.z || origin.x > maxs.x ||
+            origin.y > maxs.y || origin.z > maxs.z) {
+            return;
+        }
+
+        if (total < capacity) {
+            pHandles[total] = entry.m_handle;
+        }
+        total++;
+    });
+
+    return total;
+}
+
+int SpatialGrid::QueryNearest(const Vector& center, float maxRadius, const void* pTag,
+                              uint32_t* pHandles, int count) const
+{
+    if (count <= 0 || m_sorted.empty()) {
+        return 0;
+    }
+
+    // No point searching past the farthest populated corner.
+    Vector farthest(std::max(std::abs(center.x - m_boundsMin.x), std::abs(center.x - m_boundsMax.x)),
+                    std::max(std::abs(center.y - m_boundsMin.y), std::abs(center.y - m_boundsMax.y)),
+                    std::max(std::abs(center.z - m_boundsMin.z), std::abs(center.z - m_boundsMax.z)));
+    const float limit = std::min(maxRadius, farthest.Length());
+
+    // Grow the search radius until it holds `count` candidates. Anything outside the radius
+    // is farther than everything inside it, so the closest `count` found are the answer.
+    float radius = std::min(m_cellSize, limit);
+    while (true) {
+        m_nearest.clear();
+        const float radiusSq = radius * radius;
+
+        VisitCells(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+                   [&](const Entry& entry) {
+                       if (pTag && entry.m_pTag != pTag) {
+                           return;
+                       }
+
+                       auto distanceSq = (entry.m_origin - center).LengthSqr();
+                       if (distanceSq <= radiusSq) {
+                           m_nearest.emplace_back(distanceSq, entry.m_handle);
+                       }
+                   });
+
+        if (static_cast<int>(m_nearest.size()) >= count || !(radius < limit)) {
+            break;
+        }
+
+        // Stop once the radius no longer grows, e.g. a zero radius or a limit it can't reach.
+        auto nextRadius = std::min(radius * 2.0f, limit);
+        if (!(nextRadius > radius)) {
+            break;
+        }
+        radius = nextRadius;
+    }
+
+    auto found = std::min(count, static_cast<int>(m_nearest.size()));
+    std::partial_sort(m_nearest.begin(), m_nearest.begin() + found, m_nearest.end());
+
+    for (int i = 0; i < found; i++) {
+        pHandles[i] = m_nearest[i].second;
+    }
+
+    return found;
+}
+
+}  // namespace counterstrikesharp
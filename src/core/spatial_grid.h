@@ -0,0 +1,88 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <mathlib/vector.h>
+
+namespace counterstrikesharp {
+
+/**
+ * Uniform grid over the XY plane, rebuilt wholesale from a point list. Cells are
+ * stored as ranges into one array sorted by cell, so a rebuild reuses its storage
+ * and a query only walks the cells its bounds overlap. Z is tested per point.
+ */
+class SpatialGrid {
+public:
+    struct Entry {
+        Vector m_origin;
+        uint32_t m_handle;
+        const void* m_pTag;  // opaque group, queries can restrict themselves to one
+    };
+
+    explicit SpatialGrid(float cellSize = 256.0f);
+
+    void Clear();
+    void Add(const Vector& origin, uint32_t handle, const void* pTag);
+    /** Sorts the entries added since Clear into their cells, must be called before querying. */
+    void Build();
+
+    size_t Size() const { return m_entries.size(); }
+
+    /**
+     * Queries write at most `capacity` handles and return the total number of matches,
+     * so callers can retry with a larger buffer. A null `pTag` matches every entry.
+     */
+    int QueryRadius(const Vector& center, float radius, const void* pTag, uint32_t* pHandles,
+                    int capacity) const;
+    int QueryBox(const Vector& mins, const Vector& maxs, const void* pTag, uint32_t* pHandles,
+                 int capacity) const;
+
+    /** Writes up to `count` handles nearest to `center` within `maxRadius`, closest first. */
+    int QueryNearest(const Vector& center, float maxRadius, const void* pTag, uint32_t* pHandles,
+                     int count) const;
+
+private:
+    struct CellRange {
+        uint32_t m_begin;
+        uint32_t m_end;
+    };
+
+    uint64_t CellKey(int32_t x, int32_t y) const;
+    int32_t CellCoord(float value) const;
+
+    template <typename Visitor>
+    void VisitCells(float minX, float minY, float maxX, float maxY, Visitor&& visitor) const;
+
+    float m_cellSize;
+    float m_inverseCellSize;
+    Vector m_boundsMin;
+    Vector m_boundsMax;
+
+    std::vector<Entry> m_entries;
+    std::vector<uint64_t> m_entryKeys;
+    std::vector<uint32_t> m_order;
+    std::vector<Entry> m_sorted;
+    std::unordered_map<uint64_t, CellRange> m_cells;
+
+    mutable std::vector<std::pair<float, uint32_t>> m_nearest;
+};
+
+}  // namespace counterstrikesharp
@@ -43,20 +43,110 @@ namespace counterstrikesharp {
 namespace timers {
 double universal_time = 0.0f;
 double timer_next_think = 0.0f;
-} // namespace timers
 
-timers::Timer::Timer(float interval, float exec_time, CallbackT callback, int flags)
-    : m_interval(interval), m_exec_time(exec_time), m_flags(flags), m_kill_me(false),
-      m_in_exec(false)
+// Granularity of the timer wheel, matches the cadence RunFrame is driven at.
+constexpr double timer_step = 0.1;
+
+static uint64_t StepForTime(double time) { return time <= 0.0 ? 0 : static_cast<uint64_t>(time / timer_step); }
+
+void TimerWheelNode::Unlink()
+{
+    m_prev->m_next = m_next;
+    m_next->m_prev = m_prev;
+    m_prev = m_next = this;
+}
+
+void TimerWheelNode::LinkBefore(TimerWheelNode* head)
+{
+    m_prev = head->m_prev;
+    m_next = head;
+    head->m_prev->m_next = this;
+    head->m_prev = this;
+}
+
+TimerWheel::TimerWheel() = default;
+
+void TimerWheel::Insert(TimerWheelNode* node, uint64_t expires)
+{
+    node->Unlink();
+    node->m_expires = std::max(expires, m_current);
+    Place(node);
+}
+
+void TimerWheel::Place(TimerWheelNode* node)
+{
+    auto expires = node->m_expires;
+    auto delta = expires - m_current;
+
+    if (delta < kRootSize) {
+        node->LinkBefore(&m_root[expires & (kRootSize - 1)]);
+        return;
+    }
+
+    // Anything further out than the wheel can represent parks in the last slot of the
+    // outermost level and gets re-placed each time that slot cascades.
+    if (delta >= kMaxDelta) {
+        expires = m_current + kMaxDelta - 1;
+        delta = kMaxDelta - 1;
+    }
+
+    for (int level = 0; level < kLevels - 1; level++) {
+        auto shift = kRootBits + kLevelBits * level;
+        if (delta < (1ull << (shift + kLevelBits))) {
+            node->LinkBefore(&m_levels[level][(expires >> shift) & (kLevelSize - 1)]);
+            return;
+        }
+    }
+}
+
+void TimerWheel::Cascade(int level, uint64_t index)
 {
-    m_callback = globals::callbackManager.CreateCallback("Timer");
-    m_callback->AddListener(callback);
+    TimerWheelNode pending;
+    auto* head = &m_levels[level][index];
+    if (!head->IsLinked()) return;
+
+    // Splice the whole slot out first, re-placing may land nodes back on this level.
+    pending.m_next = head->m_next;
+    pending.m_prev = head->m_prev;
+    pending.m_next->m_prev = &pending;
+    pending.m_prev->m_next = &pending;
+    head->m_next = head->m_prev = head;
+
+    while (pending.IsLinked()) {
+        auto* node = pending.m_next;
+        node->Unlink();
+        Place(node);
+    }
 }
 
-timers::Timer::~Timer() { globals::callbackManager.ReleaseCallback(m_callback); }
+void TimerWheel::Advance(uint64_t step, TimerWheelNode* due)
+{
+    while (m_current <= step) {
+        auto index = m_current & (kRootSize - 1);
+        if (index == 0) {
+            for (int level = 0; level < kLevels - 1; level++) {
+                auto shift = kRootBits + kLevelBits * level;
+                auto levelIndex = (m_current >> shift) & (kLevelSize - 1);
+                Cascade(level, levelIndex);
+                if (levelIndex != 0) break;
+            }
+        }
+
+        auto* head = &m_root[index];
+        while (head->IsLinked()) {
+            auto* node = head->m_next;
+            node->Unlink();
+            node->LinkBefore(due);
+        }
 
-TimerSystem::TimerSystem()
+        m_current++;
+    }
+}
+} // namespace timers
+
+TimerSystem::TimerSystem() : m_timer_context(fxNativeContext{})
 {
+    m_timer_script_context = ScriptContextRaw(m_timer_context);
     m_has_map_ticked = false;
     m_has_map_simulated = false;
     m_last_ticked_time = 0.0f;
@@ -76,9 +166,8 @@ void TimerSystem::OnShutdown()
 
 void TimerSystem::OnLevelEnd()
 {
-    if (on_map_end_callback && on_map_end_callback->GetFunctionCount()) {
-        on_map_end_callback->ScriptContext().Reset();
-        on_map_end_callback->Execute();
+    if (on_map_end_callback) {
+        on_map_end_callback->Dispatch();
     }
 
     globals::timerSystem.RemoveMapChangeTimers();
@@ -120,10 +209,13 @@ void TimerSystem::OnGameFrame(bool simulating)
         timers::timer_next_think = CalculateNextThink(timers::timer_next_think, 0.1f);
     }
 
-    if (m_on_tick_callback_->GetFunctionCount()) {
-        m_on_tick_callback_->ScriptContext().Reset();
-        m_on_tick_callback_->Execute();
-    }
+    // Tick timers are evaluated on every frame rather than on the 0.1s think.
+    m_tick_count++;
+    timers::TimerWheelNode due_ticks;
+    m_tick_wheel.Advance(m_tick_count, &due_ticks);
+    ExecuteTimers(&due_ticks);
+
+    m_on_tick_callback_->Dispatch();
 
     globals::playerManager.RunAuthChecks();
 }
@@ -139,78 +231,164 @@ double TimerSystem::CalculateNextThink(double last_think_time, float interval)
 
 void TimerSystem::RunFrame()
 {
-    for (int i = m_once_off_timers.size() - 1; i >= 0; i--) {
-        auto timer = m_once_off_timers[i];
-        if (timers::universal_time >= timer->m_exec_time) {
-            timer->m_in_exec = true;
-            timer->m_callback->ScriptContext().Reset();
-            timer->m_callback->Execute();
+    // Detach everything due up to now before running any callbacks, so timers that
+    // get created or killed from inside a callback never disturb the walk.
+    timers::TimerWheelNode due;
+    m_timer_wheel.Advance(timers::StepForTime(timers::universal_time), &due);
+    ExecuteTimers(&due);
+}
 
-            m_once_off_timers.erase(m_once_off_timers.begin() + i);
-            delete timer;
+void TimerSystem::ExecuteTimers(timers::TimerWheelNode* due)
+{
+    while (due->IsLinked()) {
+        auto timer = static_cast<timers::Timer*>(due->m_next);
+        timer->Unlink();
+
+        // Expiry steps are rounded down, so a timer can land a step early.
+        if (!(timer->m_flags & TIMER_FLAG_TICK) && timers::universal_time < timer->m_exec_time) {
+            ScheduleTimer(timer);
+            continue;
         }
-    }
 
-    for (int i = m_repeat_timers.size() - 1; i >= 0; i--) {
-        auto timer = m_repeat_timers[i];
-        if (timers::universal_time >= timer->m_exec_time) {
-            timer->m_in_exec = true;
-            timer->m_callback->ScriptContext().Reset();
-            timer->m_callback->Execute();
+        timer->m_in_exec = true;
+        m_timer_script_context.Reset();
+        if (timer->m_callback) {
+            timer->m_callback(&m_timer_context);
+        }
 
-            if (timer->m_kill_me) {
-                m_repeat_timers.erase(m_repeat_timers.begin() + i);
-                delete timer;
-                continue;
-            }
+        if (!(timer->m_flags & TIMER_FLAG_REPEAT) || timer->m_kill_me) {
+            ReleaseTimer(timer);
+            continue;
+        }
 
-            timer->m_in_exec = false;
-            timer->m_exec_time = CalculateNextThink(timer->m_exec_time, timer->m_interval);
+        timer->m_in_exec = false;
+        if (timer->m_flags & TIMER_FLAG_TICK) {
+            // Tick wheel steps are exact, so the wheel expiry doubles as the target tick.
+            m_tick_wheel.Insert(timer, timer->m_expires + static_cast<uint64_t>(timer->m_interval));
+            continue;
         }
+
+        timer->m_exec_time = CalculateNextThink(timer->m_exec_time, timer->m_interval);
+        ScheduleTimer(timer);
     }
 }
 
+void TimerSystem::ScheduleTimer(timers::Timer* timer)
+{
+    m_timer_wheel.Insert(timer, timers::StepForTime(timer->m_exec_time));
+}
+
 void TimerSystem::RemoveMapChangeTimers()
 {
-    for (auto timer : m_once_off_timers) {
-        if (timer->m_flags & TIMER_FLAG_NO_MAPCHANGE) {
-            KillTimer(timer);
+    for (uint32_t i = 0; i < m_timer_slabs.size() * kTimerSlabSize; i++) {
+        auto timer = TimerAt(i);
+        if (timer->m_in_use && (timer->m_flags & TIMER_FLAG_NO_MAPCHANGE)) {
+            StopTimer(timer);
         }
     }
+}
 
-    for (auto timer : m_repeat_timers) {
-        if (timer->m_flags & TIMER_FLAG_NO_MAPCHANGE) {
-            KillTimer(timer);
+timers::Timer* TimerSystem::AllocateTimer(float interval, float exec_time, CallbackT callback, int flags)
+{
+    if (m_free_timers.empty()) {
+        auto first = static_cast<uint32_t>(m_timer_slabs.size() * kTimerSlabSize);
+        auto slab = std::make_unique<timers::Timer[]>(kTimerSlabSize);
+        for (uint32_t i = 0; i < kTimerSlabSize; i++) {
+            slab[i].m_index = first + i;
+        }
+        m_timer_slabs.push_back(std::move(slab));
+
+        // Keep the free list able to hold every slot so releasing never allocates.
+        m_free_timers.reserve(m_timer_slabs.size() * kTimerSlabSize);
+        for (uint32_t i = kTimerSlabSize; i > 0; i--) {
+            m_free_timers.push_back(first + i - 1);
         }
     }
+
+    auto timer = TimerAt(m_free_timers.back());
+    m_free_timers.pop_back();
+
+    timer->m_interval = interval;
+    timer->m_exec_time = exec_time;
+    timer->m_callback = callback;
+    timer->m_flags = flags;
+    timer->m_in_use = true;
+    timer->m_in_exec = false;
+    timer->m_kill_me = false;
+
+    return timer;
 }
 
-timers::Timer* TimerSystem::CreateTimer(float interval, CallbackT callback, int flags)
+void TimerSystem::ReleaseTimer(timers::Timer* timer)
 {
-    float exec_time = timers::universal_time + interval;
+    timers::TimerWheel::Remove(timer);
+    timer->m_in_use = false;
+    timer->m_callback = nullptr;
+    timer->m_serial++;
+    m_free_timers.push_back(timer->m_index);
+}
+
+uint64_t TimerSystem::TimerHandle(const timers::Timer* timer)
+{
+    return (static_cast<uint64_t>(timer->m_serial) << 32) | (timer->m_index + 1);
+}
 
-    auto timer = new timers::Timer(interval, exec_time, callback, flags);
+timers::Timer* TimerSystem::FindTimer(uint64_t handle)
+{
+    auto index = static_cast<uint32_t>(handle & 0xFFFFFFFF);
+    if (index == 0 || index > m_timer_slabs.size() * kTimerSlabSize) {
+        return nullptr;
+    }
 
-    if (flags & TIMER_FLAG_REPEAT) {
-        m_repeat_timers.push_back(timer);
-        return timer;
+    // Plugins may hold on to handles of once-off timers that have already fired.
+    auto timer = TimerAt(index - 1);
+    if (!timer->m_in_use || timer->m_serial != static_cast<uint32_t>(handle >> 32)) {
+        return nullptr;
     }
 
-    m_once_off_timers.push_back(timer);
     return timer;
 }
 
-void TimerSystem::KillTimer(timers::Timer* timer)
+uint64_t TimerSystem::CreateTimer(float interval, CallbackT callback, int flags)
+{
+    if (!callback) {
+        return 0;
+    }
+
+    float exec_time = timers::universal_time + interval;
+
+    auto timer = AllocateTimer(interval, exec_time, callback, flags & ~TIMER_FLAG_TICK);
+    ScheduleTimer(timer);
+
+    return TimerHandle(timer);
+}
+
+uint64_t TimerSystem::CreateTickTimer(int ticks, CallbackT callback, int flags)
 {
+    if (!callback) {
+        return 0;
+    }
+
+    // A tick timer always waits at least until the next frame.
+    ticks = std::max(ticks, 1);
+
+    auto timer = AllocateTimer(ticks, timers::universal_time, callback, flags | TIMER_FLAG_TICK);
+    m_tick_wheel.Insert(timer, m_tick_count + ticks);
+
+    return TimerHandle(timer);
+}
+
+void TimerSystem::KillTimer(uint64_t handle)
+{
+    auto timer = FindTimer(handle);
     if (!timer)
         return;
 
-    if (std::find(m_repeat_timers.begin(), m_repeat_timers.end(), timer) == m_repeat_timers.end() &&
-        std::find(m_once_off_timers.begin(), m_once_off_timers.end(), timer) ==
-            m_once_off_timers.end()) {
-        return;
-    }
+    StopTimer(timer);
+}
 
+void TimerSystem::StopTimer(timers::Timer* timer)
+{
     if (timer->m_kill_me)
         return;
 
@@ -220,23 +398,7 @@ void TimerSystem::KillTimer(timers::Timer* timer)
         return;
     }
 
-    if (timer->m_flags & TIMER_FLAG_REPEAT) {
-        auto it = std::remove_if(m_repeat_timers.begin(), m_repeat_timers.end(),
-                                 [timer](timers::Timer* i) { return timer == i; });
-
-        bool success;
-        if ((success = it != m_repeat_timers.end()))
-            m_repeat_timers.erase(it, m_repeat_timers.end());
-        delete timer;
-    } else {
-        auto it = std::remove_if(m_once_off_timers.begin(), m_once_off_timers.end(),
-                                 [timer](timers::Timer* i) { return timer == i; });
-
-        bool success;
-        if ((success = it != m_once_off_timers.end()))
-            m_once_off_timers.erase(it, m_once_off_timers.end());
-        delete timer;
-    }
+    ReleaseTimer(timer);
 }
 
 double TimerSystem::GetTickedTime() { return timers::universal_time; }
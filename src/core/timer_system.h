@@ -31,6 +31,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "core/global_listener.h"
@@ -43,20 +45,74 @@ class ScriptCallback;
 namespace timers {
 #define TIMER_FLAG_REPEAT (1 << 0)       /**< Timer will repeat until stopped */
 #define TIMER_FLAG_NO_MAPCHANGE (1 << 1) /**< Timer will not carry over mapchanges */
+#define TIMER_FLAG_TICK (1 << 2)         /**< Interval is measured in server ticks, set by CreateTickTimer */
 
-class Timer {
+/**
+ * Intrusive list node used by TimerWheel. Unlinking is O(1) and does not need to
+ * know which slot (or detached list) the node currently lives in.
+ */
+struct TimerWheelNode {
+    TimerWheelNode* m_prev = this;
+    TimerWheelNode* m_next = this;
+    uint64_t m_expires = 0;
+
+    bool IsLinked() const { return m_next != this; }
+    void Unlink();
+    void LinkBefore(TimerWheelNode* head);
+};
+
+/**
+ * Hierarchical timing wheel keyed by an abstract, monotonically increasing step
+ * count. Insert and Remove are O(1); Advance only touches the slots that become due
+ * and cascades a higher level slot once every time the level below wraps around.
+ */
+class TimerWheel {
+public:
+    TimerWheel();
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    void Insert(TimerWheelNode* node, uint64_t expires);
+    static void Remove(TimerWheelNode* node) { node->Unlink(); }
+
+    /** Moves every node with an expiry up to and including `step` onto `due`. */
+    void Advance(uint64_t step, TimerWheelNode* due);
+    uint64_t Current() const { return m_current; }
+
+private:
+    static constexpr int kRootBits = 8;
+    static constexpr int kLevelBits = 6;
+    static constexpr int kLevels = 4;
+    static constexpr uint64_t kRootSize = 1ull << kRootBits;
+    static constexpr uint64_t kLevelSize = 1ull << kLevelBits;
+    static constexpr uint64_t kMaxDelta = 1ull << (kRootBits + kLevelBits * (kLevels - 1));
+
+    void Place(TimerWheelNode* node);
+    void Cascade(int level, uint64_t index);
+
+    uint64_t m_current = 0;
+    TimerWheelNode m_root[kRootSize];
+    TimerWheelNode m_levels[kLevels - 1][kLevelSize];
+};
+
+/**
+ * Timers live in slabs owned by TimerSystem and are recycled through a free list, so
+ * creating or killing one never touches the heap. Plugins only ever see a handle made
+ * of the slot index and a serial that is bumped whenever the slot is released.
+ */
+class Timer : public TimerWheelNode {
     friend class TimerSystem;
 
 public:
-    Timer(float interval, float exec_time, CallbackT callback, int flags);
-    ~Timer();
-
-    float m_interval;
-    ScriptCallback *m_callback;
-    int m_flags;
-    float m_exec_time;
-    bool m_in_exec;
-    bool m_kill_me;
+    float m_interval = 0.0f;
+    float m_exec_time = 0.0f;
+    CallbackT m_callback = nullptr;
+    int m_flags = 0;
+    uint32_t m_index = 0;
+    uint32_t m_serial = 0;
+    bool m_in_use = false;
+    bool m_in_exec = false;
+    bool m_kill_me = false;
 };
 
 }  // namespace timers
@@ -74,8 +130,9 @@ public:
     double CalculateNextThink(double last_think_time, float interval);
     void RunFrame();
     void RemoveMapChangeTimers();
-    timers::Timer *CreateTimer(float interval, CallbackT callback, int flags);
-    void KillTimer(timers::Timer *timer);
+    uint64_t CreateTimer(float interval, CallbackT callback, int flags);
+    uint64_t CreateTickTimer(int ticks, CallbackT callback, int flags);
+    void KillTimer(uint64_t handle);
     double GetTickedTime();
 
 
@@ -86,7 +143,27 @@ public:
     ScriptCallback *m_on_tick_callback_ = nullptr;
     ScriptCallback *on_map_end_callback = nullptr;
 
-    std::vector<timers::Timer *> m_once_off_timers;
-    std::vector<timers::Timer *> m_repeat_timers;
+    static constexpr uint32_t kTimerSlabSize = 256;
+
+    timers::Timer* AllocateTimer(float interval, float exec_time, CallbackT callback, int flags);
+    void ReleaseTimer(timers::Timer* timer);
+    timers::Timer* FindTimer(uint64_t handle);
+    timers::Timer* TimerAt(uint32_t index) { return &m_timer_slabs[index / kTimerSlabSize][index % kTimerSlabSize]; }
+    static uint64_t TimerHandle(const timers::Timer* timer);
+
+    void StopTimer(timers::Timer* timer);
+    void ScheduleTimer(timers::Timer* timer);
+    void ExecuteTimers(timers::TimerWheelNode* due);
+
+    uint64_t m_tick_count = 0;
+    timers::TimerWheel m_timer_wheel;
+    timers::TimerWheel m_tick_wheel;
+
+    std::vector<std::unique_ptr<timers::Timer[]>> m_timer_slabs;
+    std::vector<uint32_t> m_free_timers;
+
+    // Timer callbacks take no arguments, so every timer shares one context.
+    fxNativeContext m_timer_context;
+    ScriptContextRaw m_timer_script_context;
 };
 }  // namespace counterstrikesharp
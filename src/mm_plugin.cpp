@@ -20,9 +20,12 @@
 #include "core/log.h"
 #include "core/coreconfig.h"
 #include "core/gameconfig.h"
+#include "core/signature_cache.h"
 #include "core/timer_system.h"
 #include "core/utils.h"
 #include "core/managers/entity_manager.h"
+#include "core/managers/event_manager.h"
+#include "core/cs2_sdk/schema.h"
 #include "igameeventsystem.h"
 #include "iserver.h"
 #include "scripting/callback_manager.h"
@@ -38,25 +41,61 @@ CGameEntitySystem *GameEntitySystem()
     return counterstrikesharp::globals::entitySystem;
 }
 
-// TODO: Workaround for windows, we __MUST__ have COUNTERSTRIKESHARP_API to handle it.
-// like on windows it should be `extern "C" __declspec(dllexport)`, on linux it should be anything else.
-DLL_EXPORT void InvokeNative(counterstrikesharp::fxNativeContext& context)
+// Returns false when the identifier does not name a registered native.
+static bool InvokeNativeChecked(counterstrikesharp::fxNativeContext& context, bool isGameThread)
 {
     if (context.nativeIdentifier == 0)
-        return;
+        return true;
+
+    auto nativeEntry = counterstrikesharp::ScriptEngine::GetNativeEntry(context.nativeIdentifier);
+    if (!nativeEntry) {
+        CSSHARP_CORE_WARN("Native Handler was requested but not found: {0:x}",
+                          context.nativeIdentifier);
+        return false;
+    }
 
-    if (context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_FRAME") &&
-        context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE") &&
-        counterstrikesharp::globals::gameThreadId != std::this_thread::get_id())
+    if (nativeEntry->identifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_FRAME") &&
+        nativeEntry->identifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE") &&
+        !isGameThread)
     {
         counterstrikesharp::ScriptContextRaw scriptContext(context);
         scriptContext.ThrowNativeError("Invoked on a non-main thread");
 
-        CSSHARP_CORE_CRITICAL("Native {:x} was invoked on a non-main thread", context.nativeIdentifier);
-        return;
+        CSSHARP_CORE_CRITICAL("Native {:x} was invoked on a non-main thread", nativeEntry->identifier);
+        return true;
+    }
+
+    counterstrikesharp::ScriptEngine::InvokeNative(*nativeEntry, context);
+    return true;
+}
+
+// TODO: Workaround for windows, we __MUST__ have COUNTERSTRIKESHARP_API to handle it.
+// like on windows it should be `extern "C" __declspec(dllexport)`, on linux it should be anything else.
+DLL_EXPORT void InvokeNative(counterstrikesharp::fxNativeContext& context)
+{
+    InvokeNativeChecked(context, counterstrikesharp::globals::gameThreadId == std::this_thread::get_id());
+}
+
+/**
+ * Runs `count` contiguous native contexts in one transition. Every record keeps its own
+ * result and error state, so a failing native does not abort the rest of the batch.
+ */
+DLL_EXPORT void InvokeNativeBatch(counterstrikesharp::fxNativeContext* contexts, int count)
+{
+    const bool isGameThread = counterstrikesharp::globals::gameThreadId == std::this_thread::get_id();
+
+    for (int i = 0; i < count; i++) {
+        // Flag unknown natives on their record, otherwise the batch reports it as a silent success.
+        if (!InvokeNativeChecked(contexts[i], isGameThread)) {
+            counterstrikesharp::ScriptContextRaw scriptContext(contexts[i]);
+            scriptContext.ThrowNativeError("Native was requested but not found");
+        }
     }
+}
 
-    counterstrikesharp::ScriptEngine::InvokeNative(context);
+DLL_EXPORT uint64_t ResolveNative(uint64_t nativeIdentifier)
+{
+    return counterstrikesharp::ScriptEngine::ResolveNative(nativeIdentifier);
 }
 
 class GameSessionConfiguration_t
@@ -124,13 +163,35 @@ bool CounterStrikeSharpMMPlugin::Load(PluginId id, ISmmAPI* ismm, char* error, s
         return false;
     }
 
+    globals::signatureCache = new CSignatureCache(utils::GamedataDirectory() + "/signatures.cache");
+    globals::signatureCache->Load();
+
     globals::Initialize();
 
     CSSHARP_CORE_INFO("Globals loaded.");
+
+    if (globals::coreConfig->WarmSchemaCacheOnStartup) {
+        auto classes_path = std::string(utils::GamedataDirectory() + "/schema_classes.txt");
+        int warmed = schema::WarmOffsetCache(classes_path);
+        if (warmed < 0) {
+            CSSHARP_CORE_WARN("Could not read \'{}\', schema offsets will be cached lazily.", classes_path);
+        } else {
+            CSSHARP_CORE_INFO("Schema offset cache warmed with {} classes.", warmed);
+        }
+    }
     globals::mmPlugin = &gPlugin;
 
     CALL_GLOBAL_LISTENER(OnAllInitialized());
 
+    // A late load misses StartupServer for the running map, attach to its entity system now
+    // so the designer name index is seeded and kept up to date until the next map starts.
+    if (late && globals::entitySystem) {
+        globals::entitySystem->AddListenerEntity(&globals::entityManager.entityListener);
+        globals::entityManager.OnStartupServer();
+    }
+
+    globals::signatureCache->Save();
+
     on_activate_callback = globals::callbackManager.CreateCallback("OnMapStart");
 
     SH_ADD_HOOK_MEMFUNC(IServerGameDLL, GameFrame, globals::server, this,
@@ -158,11 +219,10 @@ void CounterStrikeSharpMMPlugin::Hook_StartupServer(const GameSessionConfigurati
 {
     globals::entitySystem = interfaces::pGameResourceServiceServer->GetGameEntitySystem();
     globals::entitySystem->AddListenerEntity(&globals::entityManager.entityListener);
+    globals::entityManager.OnStartupServer();
     globals::timerSystem.OnStartupServer();
 
-    on_activate_callback->ScriptContext().Reset();
-    on_activate_callback->ScriptContext().Push(globals::getGlobalVars()->mapname);
-    on_activate_callback->Execute();
+    on_activate_callback->Dispatch(globals::getGlobalVars()->mapname);
 }
 
 bool CounterStrikeSharpMMPlugin::Unload(char* error, size_t maxlen)
@@ -174,6 +234,11 @@ bool CounterStrikeSharpMMPlugin::Unload(char* error, size_t maxlen)
 
     globals::callbackManager.ReleaseCallback(on_activate_callback);
 
+    // Keeps signatures resolved by plugins at runtime for the next boot.
+    globals::signatureCache->Save();
+    delete globals::signatureCache;
+    globals::signatureCache = nullptr;
+
     return true;
 }
 
@@ -201,19 +266,26 @@ void CounterStrikeSharpMMPlugin::Hook_GameFrame(bool simulating, bool bFirstTick
      */
     globals::timerSystem.OnGameFrame(simulating);
 
-    std::lock_guard<std::mutex> lock(m_nextTasksLock);
+    {
+        std::lock_guard<std::mutex> lock(m_nextTasksLock);
 
-    if (m_nextTasks.empty())
-        return;
+        if (!m_nextTasks.empty()) {
+            CSSHARP_CORE_TRACE("Executing queued tasks of size: {0} on tick number {1}",
+                               m_nextTasks.size(), globals::getGlobalVars()->tickcount);
 
-    CSSHARP_CORE_TRACE("Executing queued tasks of size: {0} on tick number {1}", m_nextTasks.size(),
-                       globals::getGlobalVars()->tickcount);
+            for (size_t i = 0; i < m_nextTasks.size(); i++) {
+                m_nextTasks[i]();
+            }
 
-    for (size_t i = 0; i < m_nextTasks.size(); i++) {
-        m_nextTasks[i]();
+            m_nextTasks.clear();
+        }
     }
 
-    m_nextTasks.clear();
+    // Send the deduplicated state changes for every networked write made this frame.
+    schema::FlushStateChanges();
+
+    // Plugin created events only live for the frame they were created in.
+    globals::eventManager.FreeUnfiredEvents();
 }
 
 // Potentially might not work
@@ -20,32 +20,48 @@
 
 namespace counterstrikesharp {
 
-ScriptCallback::ScriptCallback(const char* szName) : m_root_context(fxNativeContext{})
+ScriptCallback::ScriptCallback(const char* szName)
+    : m_functions(std::make_shared<const FunctionList>()), m_root_context(fxNativeContext{})
 {
     m_script_context_raw = ScriptContextRaw(m_root_context);
     m_name = std::string(szName);
 }
 
-ScriptCallback::~ScriptCallback() { m_functions.clear(); }
+ScriptCallback::~ScriptCallback() = default;
 
 void ScriptCallback::AddListener(CallbackT fnPluginFunction)
 {
-    m_functions.push_back(fnPluginFunction);
+    auto functions = std::make_shared<FunctionList>(*m_functions);
+    functions->push_back(fnPluginFunction);
+    m_functions = std::move(functions);
+    m_has_listeners = true;
 }
 
 bool ScriptCallback::RemoveListener(CallbackT fnPluginFunction)
 {
     bool bSuccess = true;
 
-    m_functions.erase(std::remove(m_functions.begin(), m_functions.end(), fnPluginFunction),
-                      m_functions.end());
+    if (std::find(m_functions->begin(), m_functions->end(), fnPluginFunction) == m_functions->end()) {
+        return bSuccess;
+    }
+
+    auto functions = std::make_shared<FunctionList>(*m_functions);
+    functions->erase(std::remove(functions->begin(), functions->end(), fnPluginFunction),
+                     functions->end());
+    m_functions = std::move(functions);
+    m_has_listeners = !m_functions->empty();
 
     return bSuccess;
 }
 
 void ScriptCallback::Execute(bool bResetContext)
 {
-    for (auto fnMethodToCall : m_functions) {
+    if (!m_has_listeners) {
+        return;
+    }
+
+    // Hold on to the current list so listeners can (un)register from inside a callback.
+    for (auto fnMethodToCall : GetFunctions()) {
         if (fnMethodToCall) {
             fnMethodToCall(&ScriptContextStruct());
         }
@@ -64,29 +80,49 @@ ScriptCallback* CallbackManager::CreateCallback(const char* szName)
 {
     CSSHARP_CORE_TRACE("Creating callback {0}", szName);
     auto* pCallback = new ScriptCallback(szName);
+    pCallback->m_registry_index = m_managed.size();
     m_managed.push_back(pCallback);
 
+    if (!pCallback->m_name.empty()) {
+        m_named[pCallback->m_name].push_back(pCallback);
+    }
+
     return pCallback;
 }
 
 ScriptCallback* CallbackManager::FindCallback(const char* szName)
 {
-    for (auto* pMarshal : m_managed) {
-        if (strcmp(pMarshal->GetName().c_str(), szName) == 0) {
-            return pMarshal;
-        }
+    auto it = m_named.find(szName);
+    if (it == m_named.end()) {
+        return nullptr;
     }
 
-    return nullptr;
+    return it->second.front();
 }
 
 void CallbackManager::ReleaseCallback(ScriptCallback* pCallback)
 {
-    auto I = std::remove_if(m_managed.begin(), m_managed.end(),
-                            [pCallback](ScriptCallback* pI) { return pCallback == pI; });
+    if (!pCallback) return;
+
+    // Swap-remove through the index the callback carries, no scan of m_managed.
+    auto index = pCallback->m_registry_index;
+    if (index < m_managed.size() && m_managed[index] == pCallback) {
+        m_managed[index] = m_managed.back();
+        m_managed[index]->m_registry_index = index;
+        m_managed.pop_back();
+    }
+
+    if (!pCallback->m_name.empty()) {
+        auto it = m_named.find(pCallback->m_name);
+        if (it != m_named.end()) {
+            auto& callbacks = it->second;
+            callbacks.erase(std::remove(callbacks.begin(), callbacks.end(), pCallback), callbacks.end());
+            if (callbacks.empty()) {
+                m_named.erase(it);
+            }
+        }
+    }
 
-    if (I != m_managed.end())
-        m_managed.erase(I, m_managed.end());
     delete pCallback;
 }
 
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "core/global_listener.h"
@@ -26,14 +29,53 @@ namespace counterstrikesharp {
 
 class ScriptCallback
 {
+    friend class CallbackManager;
+
   public:
     ScriptCallback(const char* szName);
     ~ScriptCallback();
+    using FunctionList = std::vector<CallbackT>;
+
+    /**
+     * Snapshot of the listeners at the time it was taken. Adding or removing listeners
+     * swaps in a new list instead of touching the current one, so a snapshot stays valid
+     * while listeners change underneath it and taking one never allocates.
+     */
+    class Functions
+    {
+      public:
+        explicit Functions(std::shared_ptr<const FunctionList> list) : m_list(std::move(list)) {}
+        FunctionList::const_iterator begin() const { return m_list->begin(); }
+        FunctionList::const_iterator end() const { return m_list->end(); }
+        size_t size() const { return m_list->size(); }
+        bool empty() const { return m_list->empty(); }
+
+      private:
+        std::shared_ptr<const FunctionList> m_list;
+    };
+
     void AddListener(CallbackT fnPluginFunction);
     bool RemoveListener(CallbackT fnPluginFunction);
-    std::string GetName() { return m_name; }
-    unsigned int GetFunctionCount() { return m_functions.size(); }
-    std::vector<CallbackT> GetFunctions() { return m_functions; }
+    const std::string& GetName() const { return m_name; }
+    unsigned int GetFunctionCount() { return m_functions->size(); }
+    Functions GetFunctions() const { return Functions(m_functions); }
+
+    /** Cheap presence check, hook sites should test this before doing any context work. */
+    bool HasListeners() const { return m_has_listeners; }
+
+    /**
+     * Resets the context, pushes `args` and executes, but only when somebody is
+     * listening. Returns false without touching the context otherwise.
+     */
+    template <typename... Args> bool Dispatch(const Args&... args)
+    {
+        if (!m_has_listeners) return false;
+
+        m_script_context_raw.Reset();
+        (m_script_context_raw.Push(args), ...);
+        Execute();
+        return true;
+    }
 
     void Execute(bool bResetContext = true);
     void Reset();
@@ -41,10 +83,12 @@ class ScriptCallback
     fxNativeContext& ScriptContextStruct() { return m_root_context; }
 
   private:
-    std::vector<CallbackT> m_functions;
+    std::shared_ptr<const FunctionList> m_functions;
     std::string m_name;
     ScriptContextRaw m_script_context_raw;
     fxNativeContext m_root_context;
+    size_t m_registry_index = 0;
+    bool m_has_listeners = false;
 };
 
 class CallbackManager : public GlobalClass
@@ -61,6 +105,9 @@ class CallbackManager : public GlobalClass
 
   private:
     std::vector<ScriptCallback*> m_managed;
+    // Only named callbacks can be looked up, anonymous ones ("") are never indexed.
+    // Same-named callbacks resolve in creation order, like the old linear lookup did.
+    std::unordered_map<std::string, std::vector<ScriptCallback*>> m_named;
 };
 
 class CallbackPair
@@ -70,7 +117,7 @@ class CallbackPair
     CallbackPair(bool bNoCallbacks);
     ~CallbackPair();
     bool HasCallbacks() const
-    { return pre->GetFunctionCount() > 0 || post->GetFunctionCount() > 0; }
+    { return pre->HasListeners() || post->HasListeners(); }
 
   public:
     ScriptCallback* pre;
@@ -14,8 +14,11 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 
+#include <cmath>
+#include <cstring>
 #include <ios>
 #include <sstream>
+#include <vector>
 
 #include "scripting/autonative.h"
 #include "scripting/script_engine.h"
@@ -23,6 +26,8 @@
 #include "core/log.h"
 #include "core/managers/player_manager.h"
 #include "core/managers/entity_manager.h"
+#include "core/cs2_sdk/schema.h"
+#include "core/function.h"
 
 #include <public/entity2/entitysystem.h>
 
@@ -162,6 +167,307 @@ void UnhookEntityOutput(ScriptContext& script_context)
     globals::entityManager.UnhookEntityOutput(szClassname, szOutput, callback, mode);
 }
 
+static EntityListenerType GetEntityListenerType(ScriptContext& script_context, int index)
+{
+    auto type = script_context.GetArgument<int>(index);
+    if (type < 0 || type >= static_cast<int>(EntityListenerType::Count)) {
+        script_context.ThrowNativeError("Invalid entity listener type %d", type);
+        return EntityListenerType::Count;
+    }
+
+    return static_cast<EntityListenerType>(type);
+}
+
+void HookEntityListener(ScriptContext& script_context)
+{
+    auto type = GetEntityListenerType(script_context, 0);
+    if (type == EntityListenerType::Count) {
+        return;
+    }
+
+    auto szDesignerName = script_context.GetArgument<const char*>(1);
+    if (!szDesignerName || !*szDesignerName) {
+        script_context.ThrowNativeError("Invalid entity listener designer name");
+        return;
+    }
+
+    auto callback = script_context.GetArgument<CallbackT>(2);
+    globals::entityManager.HookEntityListener(type, szDesignerName, callback);
+}
+
+void UnhookEntityListener(ScriptContext& script_context)
+{
+    auto type = GetEntityListenerType(script_context, 0);
+    if (type == EntityListenerType::Count) {
+        return;
+    }
+
+    auto szDesignerName = script_context.GetArgument<const char*>(1);
+    if (!szDesignerName) {
+        script_context.ThrowNativeError("Invalid entity listener designer name");
+        return;
+    }
+
+    auto callback = script_context.GetArgument<CallbackT>(2);
+    globals::entityManager.UnhookEntityListener(type, szDesignerName, callback);
+}
+
+uint64_t GetEntityListenerHits(ScriptContext& script_context)
+{
+    auto type = GetEntityListenerType(script_context, 0);
+    if (type == EntityListenerType::Count) {
+        return 0;
+    }
+
+    auto szDesignerName = script_context.GetArgument<const char*>(1);
+    if (!szDesignerName) {
+        script_context.ThrowNativeError("Invalid entity listener designer name");
+        return 0;
+    }
+
+    return globals::entityManager.GetEntityListenerHits(type, szDesignerName);
+}
+
+int GetEntitiesByDesignerName(ScriptContext& script_context)
+{
+    auto szDesignerName = script_context.GetArgument<const char*>(0);
+    auto bExact = script_context.GetArgument<bool>(1);
+    auto pHandles = script_context.GetArgument<uint32_t*>(2);
+    auto capacity = script_context.GetArgument<int>(3);
+
+    if (!szDesignerName) {
+        script_context.ThrowNativeError("Invalid designer name");
+        return 0;
+    }
+
+    if (capacity > 0 && !pHandles) {
+        script_context.ThrowNativeError("Invalid entity handle buffer");
+        return 0;
+    }
+
+    return globals::entityManager.GetEntitiesByDesignerName(szDesignerName, bExact, pHandles,
+                                                            capacity);
+}
+
+// Deepest pointer chain a snapshot column may follow, e.g. pawn -> scene node -> origin.
+static constexpr int kMaxSnapshotPathDepth = 8;
+
+struct SnapshotColumn_t {
+    const SchemaFieldToken* m_tokens[kMaxSnapshotPathDepth];
+    int m_depth;
+    size_t m_stride;
+    uint8_t* m_pOutput;
+};
+
+/**
+ * Fills caller owned structure-of-arrays columns from a list of entity handles.
+ * Each column is a 0 terminated path of field tokens: every token but the last must be
+ * a pointer field and is dereferenced, the last is copied `width` elements wide.
+ * `elementSizes` holds the managed element size of every column, which has to match the
+ * leaf type so e.g. a 4 byte native long is not read into an 8 byte managed one. A column
+ * may not be wider than the schema field it reads.
+ * Stale handles and paths that hit a null pointer leave zeroed cells and flag the row
+ * invalid. Returns the number of valid rows.
+ */
+int SnapshotEntityFields(ScriptContext& script_context)
+{
+    auto pHandles = script_context.GetArgument<const uint32_t*>(0);
+    auto handleCount = script_context.GetArgument<int>(1);
+    auto pFieldPaths = script_context.GetArgument<const uint32_t*>(2);
+    auto pWidths = script_context.GetArgument<const int*>(3);
+    auto pElementSizes = script_context.GetArgument<const int*>(4);
+    auto pColumns = script_context.GetArgument<uint8_t**>(5);
+    auto columnCount = script_context.GetArgument<int>(6);
+    auto pValid = script_context.GetArgument<uint8_t*>(7);
+
+    if (handleCount <= 0 || columnCount < 0) {
+        return 0;
+    }
+
+    if (!pHandles || (columnCount > 0 && (!pFieldPaths || !pWidths || !pElementSizes || !pColumns))) {
+        script_context.ThrowNativeError("Invalid entity snapshot buffers");
+        return 0;
+    }
+
+    // Natives only run on the game thread, keep the scratch space between calls.
+    static std::vector<SnapshotColumn_t> columns;
+    static std::vector<uintptr_t> entities;
+    static std::vector<uint8_t> rowValid;
+    columns.resize(columnCount);
+    entities.resize(handleCount);
+    rowValid.resize(handleCount);
+
+    const uint32_t* pPath = pFieldPaths;
+    for (int i = 0; i < columnCount; i++) {
+        auto& column = columns[i];
+        column.m_depth = 0;
+
+        for (; *pPath; pPath++) {
+            auto token = schema::GetFieldToken(*pPath);
+            if (!token) {
+                script_context.ThrowNativeError("Invalid schema field token in snapshot column %d", i);
+                return 0;
+            }
+
+            if (column.m_depth == kMaxSnapshotPathDepth) {
+                script_context.ThrowNativeError("Snapshot column %d is nested deeper than %d fields", i,
+                                                kMaxSnapshotPathDepth);
+                return 0;
+            }
+
+            column.m_tokens[column.m_depth++] = token;
+        }
+        pPath++;
+
+        if (column.m_depth == 0 || pWidths[i] <= 0 || !pColumns[i]) {
+            script_context.ThrowNativeError("Invalid entity snapshot column %d", i);
+            return 0;
+        }
+
+        for (int depth = 0; depth < column.m_depth - 1; depth++) {
+            if (column.m_tokens[depth]->dataType != DATA_TYPE_POINTER) {
+                script_context.ThrowNativeError(
+                    "Snapshot column %d dereferences a field that is not a pointer", i);
+                return 0;
+            }
+        }
+
+        const auto leafSize = column.m_tokens[column.m_depth - 1]->size;
+        if (pElementSizes[i] != leafSize) {
+            script_context.ThrowNativeError(
+                "Snapshot column %d reads %d byte fields into %d byte elements", i, leafSize,
+                pElementSizes[i]);
+            return 0;
+        }
+
+        column.m_stride = static_cast<size_t>(leafSize) * pWidths[i];
+
+        // A single element always fits, it was checked against the field's type above.
+        const auto fieldSize = column.m_tokens[column.m_depth - 1]->fieldSize;
+        if (pWidths[i] > 1 && column.m_stride > static_cast<size_t>(fieldSize)) {
+            script_context.ThrowNativeError("Snapshot column %d reads %d bytes from a %d byte field", i,
+                                            static_cast<int>(column.m_stride), fieldSize);
+            return 0;
+        }
+        column.m_pOutput = pColumns[i];
+    }
+
+    // Resolve every handle once up front, the column loops below only see raw addresses.
+    for (int row = 0; row < handleCount; row++) {
+        CEntityHandle hEntity(pHandles[row]);
+        auto pEntity = hEntity.IsValid() ? globals::entitySystem->GetBaseEntity(hEntity) : nullptr;
+
+        entities[row] = reinterpret_cast<uintptr_t>(pEntity);
+        rowValid[row] = pEntity != nullptr;
+    }
+
+    for (auto& column : columns) {
+        const auto pLeaf = column.m_tokens[column.m_depth - 1];
+        auto pOutput = column.m_pOutput;
+
+        for (int row = 0; row < handleCount; row++, pOutput += column.m_stride) {
+            auto address = entities[row];
+
+            for (int depth = 0; address && depth < column.m_depth - 1; depth++) {
+                address = *reinterpret_cast<uintptr_t*>(address + column.m_tokens[depth]->offset);
+            }
+
+            if (!address) {
+                memset(pOutput, 0, column.m_stride);
+                rowValid[row] = false;
+                continue;
+            }
+
+            memcpy(pOutput, reinterpret_cast<const void*>(address + pLeaf->offset), column.m_stride);
+        }
+    }
+
+    int validCount = 0;
+    for (int row = 0; row < handleCount; row++) {
+        validCount += rowValid[row];
+    }
+
+    if (pValid) {
+        memcpy(pValid, rowValid.data(), handleCount);
+    }
+
+    return validCount;
+}
+
+// NaN coordinates have no cell in the spatial grid, and a NaN radius never bounds a search.
+static bool IsFiniteVector(const Vector& vector)
+{
+    return std::isfinite(vector.x) && std::isfinite(vector.y) && std::isfinite(vector.z);
+}
+
+static bool IsValidQueryRadius(float radius) { return std::isfinite(radius) && radius >= 0.0f; }
+
+int FindEntitiesInRadius(ScriptContext& script_context)
+{
+    auto pOrigin = script_context.GetArgument<Vector*>(0);
+    auto radius = script_context.GetArgument<float>(1);
+    auto szDesignerName = script_context.GetArgument<const char*>(2);
+    auto pHandles = script_context.GetArgument<uint32_t*>(3);
+    auto capacity = script_context.GetArgument<int>(4);
+
+    if (!pOrigin || (capacity > 0 && !pHandles)) {
+        script_context.ThrowNativeError("Invalid spatial query arguments");
+        return 0;
+    }
+
+    if (!IsFiniteVector(*pOrigin) || !IsValidQueryRadius(radius)) {
+        script_context.ThrowNativeError("Spatial query origin and radius must be finite, radius not negative");
+        return 0;
+    }
+
+    return globals::entityManager.FindEntitiesInRadius(*pOrigin, radius, szDesignerName, pHandles,
+                                                       capacity);
+}
+
+int FindEntitiesInBox(ScriptContext& script_context)
+{
+    auto pMins = script_context.GetArgument<Vector*>(0);
+    auto pMaxs = script_context.GetArgument<Vector*>(1);
+    auto szDesignerName = script_context.GetArgument<const char*>(2);
+    auto pHandles = script_context.GetArgument<uint32_t*>(3);
+    auto capacity = script_context.GetArgument<int>(4);
+
+    if (!pMins || !pMaxs || (capacity > 0 && !pHandles)) {
+        script_context.ThrowNativeError("Invalid spatial query arguments");
+        return 0;
+    }
+
+    if (!IsFiniteVector(*pMins) || !IsFiniteVector(*pMaxs)) {
+        script_context.ThrowNativeError("Spatial query bounds must be finite");
+        return 0;
+    }
+
+    return globals::entityManager.FindEntitiesInBox(*pMins, *pMaxs, szDesignerName, pHandles,
+                                                    capacity);
+}
+
+int FindNearestEntities(ScriptContext& script_context)
+{
+    auto pOrigin = script_context.GetArgument<Vector*>(0);
+    auto maxRadius = script_context.GetArgument<float>(1);
+    auto szDesignerName = script_context.GetArgument<const char*>(2);
+    auto pHandles = script_context.GetArgument<uint32_t*>(3);
+    auto count = script_context.GetArgument<int>(4);
+
+    if (!pOrigin || (count > 0 && !pHandles)) {
+        script_context.ThrowNativeError("Invalid spatial query arguments");
+        return 0;
+    }
+
+    if (!IsFiniteVector(*pOrigin) || !IsValidQueryRadius(maxRadius)) {
+        script_context.ThrowNativeError("Spatial query origin and radius must be finite, radius not negative");
+        return 0;
+    }
+
+    return globals::entityManager.FindNearestEntities(*pOrigin, maxRadius, szDesignerName, pHandles,
+                                                      count);
+}
+
 REGISTER_NATIVES(entities, {
     ScriptEngine::RegisterNativeHandler("GET_ENTITY_FROM_INDEX", GetEntityFromIndex);
     ScriptEngine::RegisterNativeHandler("GET_USERID_FROM_INDEX", GetUserIdFromIndex);
@@ -178,5 +484,13 @@ REGISTER_NATIVES(entities, {
     ScriptEngine::RegisterNativeHandler("GET_PLAYER_IP_ADDRESS", GetPlayerIpAddress);
     ScriptEngine::RegisterNativeHandler("HOOK_ENTITY_OUTPUT", HookEntityOutput);
     ScriptEngine::RegisterNativeHandler("UNHOOK_ENTITY_OUTPUT", UnhookEntityOutput);
+    ScriptEngine::RegisterNativeHandler("HOOK_ENTITY_LISTENER", HookEntityListener);
+    ScriptEngine::RegisterNativeHandler("UNHOOK_ENTITY_LISTENER", UnhookEntityListener);
+    ScriptEngine::RegisterNativeHandler("GET_ENTITY_LISTENER_HITS", GetEntityListenerHits);
+    ScriptEngine::RegisterNativeHandler("GET_ENTITIES_BY_DESIGNER_NAME", GetEntitiesByDesignerName);
+    ScriptEngine::RegisterNativeHandler("SNAPSHOT_ENTITY_FIELDS", SnapshotEntityFields);
+    ScriptEngine::RegisterNativeHandler("FIND_ENTITIES_IN_RADIUS", FindEntitiesInRadius);
+    ScriptEngine::RegisterNativeHandler("FIND_ENTITIES_IN_BOX", FindEntitiesInBox);
+    ScriptEngine::RegisterNativeHandler("FIND_NEAREST_ENTITIES", FindNearestEntities);
 })
 }  // namespace counterstrikesharp
\ No newline at end of file
@@ -14,6 +14,10 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 #include "core/globals.h"
+#include <deque>
+#include <string>
+#include <unordered_map>
+
 #include "core/log.h"
 
 #include "core/managers/event_manager.h"
@@ -23,7 +27,74 @@
 
 namespace counterstrikesharp {
 
-std::vector<IGameEvent *> managed_game_events;
+// Interned event keys. Building a GameEventKeySymbol_t hashes the key name, so managed
+// code resolves each name once and passes the returned handle (index + 1) afterwards.
+static std::deque<std::string> event_key_names;
+static std::vector<GameEventKeySymbol_t> event_key_symbols;
+static std::unordered_map<std::string, int> event_key_lookup;
+
+enum class GameEventKeyType : int {
+    Bool = 0,
+    Int,
+    Float,
+    String,
+    Uint64,
+    PlayerController,
+    PlayerPawn,
+};
+
+static int GetEventKeySymbol(ScriptContext &script_context) {
+    const char *key_name = script_context.GetArgument<const char *>(0);
+
+    if (!key_name || !key_name[0]) {
+        script_context.ThrowNativeError("Invalid game event key");
+        return 0;
+    }
+
+    auto it = event_key_lookup.find(key_name);
+    if (it != event_key_lookup.end()) {
+        return it->second;
+    }
+
+    // The symbol keeps a pointer to its name, deque storage never moves it.
+    const auto &name = event_key_names.emplace_back(key_name);
+    event_key_symbols.emplace_back(name.c_str());
+
+    auto symbol = static_cast<int>(event_key_symbols.size());
+    event_key_lookup.emplace(name, symbol);
+
+    return symbol;
+}
+
+static const GameEventKeySymbol_t *FindEventKeySymbol(int symbol) {
+    if (symbol <= 0 || symbol > static_cast<int>(event_key_symbols.size())) {
+        return nullptr;
+    }
+
+    return &event_key_symbols[symbol - 1];
+}
+
+/**
+ * Shared argument handling of the *_BY_SYMBOL natives. Throws and returns false when
+ * either the event or the key handle is invalid.
+ */
+static bool GetEventAndSymbol(ScriptContext &script_context, IGameEvent *&game_event,
+                              const GameEventKeySymbol_t *&key_symbol) {
+    game_event = script_context.GetArgument<IGameEvent *>(0);
+    key_symbol = FindEventKeySymbol(script_context.GetArgument<int>(1));
+
+    if (!game_event) {
+        script_context.ThrowNativeError("Invalid game event");
+        return false;
+    }
+
+    if (!key_symbol) {
+        script_context.ThrowNativeError("Invalid game event key symbol");
+        return false;
+    }
+
+    return true;
+}
 
 static void HookEvent(ScriptContext &script_context) {
     const char *name = script_context.GetArgument<const char *>(0);
@@ -45,10 +116,7 @@ static IGameEvent *CreateEvent(ScriptContext &script_context) {
     auto name = script_context.GetArgument<const char *>(0);
     bool force = script_context.GetArgument<bool>(1);
 
-    auto pEvent = globals::gameEventManager->CreateEvent(name, force);
-    managed_game_events.push_back(pEvent);
-
-    return pEvent;
+    return globals::eventManager.CreateTrackedEvent(name, force);
 }
 
 static void FireEvent(ScriptContext &script_context) {
@@ -56,10 +124,17 @@ static void FireEvent(ScriptContext &script_context) {
     bool dont_broadcast = script_context.GetArgument<bool>(1);
     if (!game_event) {
         script_context.ThrowNativeError("Invalid game event");
+        return;
+    }
+
+    // Firing hands ownership to the engine, it frees the event once dispatched. An event we no
+    // longer track was either fired already or freed at the end of the frame it was created in.
+    if (!globals::eventManager.UntrackEvent(game_event)) {
+        script_context.ThrowNativeError("Game event was already freed");
+        return;
     }
 
     globals::gameEventManager->FireEvent(game_event, dont_broadcast);
-    managed_game_events.erase(std::remove(managed_game_events.begin(), managed_game_events.end(), game_event), managed_game_events.end());
 }
 
 
@@ -253,6 +328,175 @@ static void SetUint64(ScriptContext &scriptContext) {
     }
 }
 
+static bool GetEventBoolBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return false;
+
+    return game_event->GetBool(*key_symbol);
+}
+
+static int GetEventIntBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return -1;
+
+    return game_event->GetInt(*key_symbol);
+}
+
+static float GetEventFloatBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return -1;
+
+    return game_event->GetFloat(*key_symbol);
+}
+
+static const char *GetEventStringBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return nullptr;
+
+    return game_event->GetString(*key_symbol);
+}
+
+static uint64 GetEventUint64BySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return 0;
+
+    return game_event->GetUint64(*key_symbol);
+}
+
+static void *GetEventPlayerControllerBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return nullptr;
+
+    return game_event->GetPlayerController(*key_symbol);
+}
+
+static void *GetEventPlayerPawnBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return nullptr;
+
+    return game_event->GetPlayerPawn(*key_symbol);
+}
+
+static void SetEventBoolBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetBool(*key_symbol, script_context.GetArgument<bool>(2));
+}
+
+static void SetEventIntBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetInt(*key_symbol, script_context.GetArgument<int>(2));
+}
+
+static void SetEventFloatBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetFloat(*key_symbol, script_context.GetArgument<float>(2));
+}
+
+static void SetEventStringBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetString(*key_symbol, script_context.GetArgument<const char *>(2));
+}
+
+static void SetEventUint64BySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetUint64(*key_symbol, script_context.GetArgument<uint64>(2));
+}
+
+static void SetEventPlayerControllerBySymbol(ScriptContext &script_context) {
+    IGameEvent *game_event;
+    const GameEventKeySymbol_t *key_symbol;
+    if (!GetEventAndSymbol(script_context, game_event, key_symbol)) return;
+
+    game_event->SetPlayer(*key_symbol, script_context.GetArgument<CEntityInstance *>(2));
+}
+
+/**
+ * Reads `count` keys of an event in one call. `symbols` and `types` are parallel int
+ * arrays, every value lands in its own 8 byte slot of `values`. Strings are returned as
+ * pointers owned by the event and are only valid until it is freed.
+ */
+static void ReadEventFields(ScriptContext &script_context) {
+    auto game_event = script_context.GetArgument<IGameEvent *>(0);
+    auto symbols = script_context.GetArgument<const int *>(1);
+    auto types = script_context.GetArgument<const int *>(2);
+    auto count = script_context.GetArgument<int>(3);
+    auto values = script_context.GetArgument<uint64_t *>(4);
+
+    if (!game_event) {
+        script_context.ThrowNativeError("Invalid game event");
+        return;
+    }
+
+    if (count > 0 && (!symbols || !types || !values)) {
+        script_context.ThrowNativeError("Invalid game event field buffers");
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        auto key_symbol = FindEventKeySymbol(symbols[i]);
+        if (!key_symbol) {
+            script_context.ThrowNativeError("Invalid game event key symbol at index %d", i);
+            return;
+        }
+
+        auto &slot = values[i];
+        slot = 0;
+
+        switch (static_cast<GameEventKeyType>(types[i])) {
+        case GameEventKeyType::Bool:
+            slot = game_event->GetBool(*key_symbol);
+            break;
+        case GameEventKeyType::Int:
+            *reinterpret_cast<int *>(&slot) = game_event->GetInt(*key_symbol);
+            break;
+        case GameEventKeyType::Float:
+            *reinterpret_cast<float *>(&slot) = game_event->GetFloat(*key_symbol);
+            break;
+        case GameEventKeyType::String:
+            *reinterpret_cast<const char **>(&slot) = game_event->GetString(*key_symbol);
+            break;
+        case GameEventKeyType::Uint64:
+            slot = game_event->GetUint64(*key_symbol);
+            break;
+        case GameEventKeyType::PlayerController:
+            *reinterpret_cast<void **>(&slot) = game_event->GetPlayerController(*key_symbol);
+            break;
+        case GameEventKeyType::PlayerPawn:
+            *reinterpret_cast<void **>(&slot) = game_event->GetPlayerPawn(*key_symbol);
+            break;
+        default:
+            script_context.ThrowNativeError("Invalid game event key type %d at index %d", types[i], i);
+            return;
+        }
+    }
+}
+
+static int GetLiveEventCount(ScriptContext &script_context) {
+    return static_cast<int>(globals::eventManager.GetLiveEventCount());
+}
+
 static int LoadEventsFromFile(ScriptContext &script_context) {
     auto [path, searchAll] = script_context.GetArguments<const char *, bool>();
 
@@ -286,6 +530,23 @@ REGISTER_NATIVES(events, {
     ScriptEngine::RegisterNativeHandler("GET_EVENT_UINT64", GetUint64);
     ScriptEngine::RegisterNativeHandler("SET_EVENT_UINT64", SetUint64);
 
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_KEY_SYMBOL", GetEventKeySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_BOOL_BY_SYMBOL", GetEventBoolBySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_INT_BY_SYMBOL", GetEventIntBySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_FLOAT_BY_SYMBOL", GetEventFloatBySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_STRING_BY_SYMBOL", GetEventStringBySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_UINT64_BY_SYMBOL", GetEventUint64BySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_PLAYER_CONTROLLER_BY_SYMBOL", GetEventPlayerControllerBySymbol);
+    ScriptEngine::RegisterNativeHandler("GET_EVENT_PLAYER_PAWN_BY_SYMBOL", GetEventPlayerPawnBySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_BOOL_BY_SYMBOL", SetEventBoolBySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_INT_BY_SYMBOL", SetEventIntBySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_FLOAT_BY_SYMBOL", SetEventFloatBySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_STRING_BY_SYMBOL", SetEventStringBySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_UINT64_BY_SYMBOL", SetEventUint64BySymbol);
+    ScriptEngine::RegisterNativeHandler("SET_EVENT_PLAYER_CONTROLLER_BY_SYMBOL", SetEventPlayerControllerBySymbol);
+    ScriptEngine::RegisterNativeHandler("READ_EVENT_FIELDS", ReadEventFields);
+    ScriptEngine::RegisterNativeHandler("GET_LIVE_EVENT_COUNT", GetLiveEventCount);
+
 
     ScriptEngine::RegisterNativeHandler("LOAD_EVENTS_FROM_FILE", LoadEventsFromFile);
 })
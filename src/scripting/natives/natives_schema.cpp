@@ -236,11 +236,119 @@ void SetSchemaValueByName(ScriptContext& script_context)
     }
 }
 
+uint32_t GetSchemaFieldToken(ScriptContext& script_context)
+{
+    auto className = script_context.GetArgument<const char*>(0);
+    auto memberName = script_context.GetArgument<const char*>(1);
+    auto dataType = script_context.GetArgument<DataType_t>(2);
+
+    auto token = schema::ResolveFieldToken(className, memberName, dataType);
+    if (!token) {
+        script_context.ThrowNativeError("Unsupported data type %d for schema field %s::%s", dataType,
+                                        className, memberName);
+    }
+
+    return token;
+}
+
+void GetSchemaValueByToken(ScriptContext& script_context)
+{
+    auto instancePointer = script_context.GetArgument<void*>(0);
+    auto token = schema::GetFieldToken(script_context.GetArgument<uint32_t>(1));
+
+    if (!token) {
+        script_context.ThrowNativeError("Invalid schema field token");
+        return;
+    }
+
+    token->get(script_context, (uintptr_t)(instancePointer) + token->offset);
+}
+
+void SetSchemaValueByToken(ScriptContext& script_context)
+{
+    auto instancePointer = script_context.GetArgument<void*>(0);
+    auto token = schema::GetFieldToken(script_context.GetArgument<uint32_t>(1));
+
+    if (!token) {
+        script_context.ThrowNativeError("Invalid schema field token");
+        return;
+    }
+
+    if (!token->writable) {
+        script_context.ThrowNativeError(
+            "Cannot set schema field with \"FollowCS2ServerGuidelines\" option enabled.");
+        return;
+    }
+
+    token->set(script_context, 2, (uintptr_t)(instancePointer) + token->offset);
+}
+
+void SetSchemaValueAndNotify(ScriptContext& script_context)
+{
+    auto instancePointer = script_context.GetArgument<void*>(0);
+    auto token = schema::GetFieldToken(script_context.GetArgument<uint32_t>(1));
+
+    if (!token) {
+        script_context.ThrowNativeError("Invalid schema field token");
+        return;
+    }
+
+    if (!token->writable) {
+        script_context.ThrowNativeError(
+            "Cannot set schema field with \"FollowCS2ServerGuidelines\" option enabled.");
+        return;
+    }
+
+    token->set(script_context, 2, (uintptr_t)(instancePointer) + token->offset);
+
+    if (token->networked) {
+        schema::NetworkStateChanged((uintptr_t)instancePointer, token->chainOffset, token->offset);
+    }
+}
+
+bool SetSchemaStateChanged(ScriptContext& script_context)
+{
+    auto instancePointer = script_context.GetArgument<void*>(0);
+    auto className = script_context.GetArgument<const char*>(1);
+    auto memberName = script_context.GetArgument<const char*>(2);
+    auto extraOffset = script_context.GetArgument<int>(3);
+    auto classKey = hash_32_fnv1a_const(className);
+    auto memberKey = hash_32_fnv1a_const(memberName);
+
+    const auto m_key = schema::GetOffset(className, classKey, memberName, memberKey);
+    if (!m_key.networked) {
+        return false;
+    }
+
+    schema::NetworkStateChanged((uintptr_t)instancePointer, schema::FindChainOffset(className),
+                                m_key.offset + extraOffset);
+    return true;
+}
+
+uint64_t GetStateChangesRequested(ScriptContext& script_context)
+{
+    return schema::GetStateChangeCounters().requested;
+}
+
+uint64_t GetStateChangesSaved(ScriptContext& script_context)
+{
+    auto counters = schema::GetStateChangeCounters();
+
+    return counters.coalesced + counters.discarded;
+}
+
 REGISTER_NATIVES(schema, {
     ScriptEngine::RegisterNativeHandler("GET_SCHEMA_OFFSET", GetSchemaOffset);
     ScriptEngine::RegisterNativeHandler("IS_SCHEMA_FIELD_NETWORKED", IsSchemaFieldNetworked);
     ScriptEngine::RegisterNativeHandler("GET_SCHEMA_VALUE_BY_NAME", GetSchemaValueByName);
     ScriptEngine::RegisterNativeHandler("SET_SCHEMA_VALUE_BY_NAME", SetSchemaValueByName);
     ScriptEngine::RegisterNativeHandler("GET_SCHEMA_CLASS_SIZE", GetSchemaClassSize);
+    ScriptEngine::RegisterNativeHandler("GET_SCHEMA_FIELD_TOKEN", GetSchemaFieldToken);
+    ScriptEngine::RegisterNativeHandler("GET_SCHEMA_VALUE_BY_TOKEN", GetSchemaValueByToken);
+    ScriptEngine::RegisterNativeHandler("SET_SCHEMA_VALUE_BY_TOKEN", SetSchemaValueByToken);
+    ScriptEngine::RegisterNativeHandler("SET_SCHEMA_VALUE_AND_NOTIFY", SetSchemaValueAndNotify);
+    ScriptEngine::RegisterNativeHandler("SET_STATE_CHANGED", SetSchemaStateChanged);
+    ScriptEngine::RegisterNativeHandler("GET_STATE_CHANGES_REQUESTED", GetStateChangesRequested);
+    ScriptEngine::RegisterNativeHandler("GET_STATE_CHANGES_SAVED", GetStateChangesSaved);
 })
 } // namespace counterstrikesharp
\ No newline at end of file
@@ -21,21 +21,41 @@
 
 namespace counterstrikesharp {
 
-timers::Timer *CreateTimer(ScriptContext &script_context) {
+// Timer handles are opaque slot/serial pairs, they only travel as pointers.
+void *CreateTimer(ScriptContext &script_context) {
     auto interval = script_context.GetArgument<float>(0);
     auto callback = script_context.GetArgument<CallbackT>(1);
     auto flags = script_context.GetArgument<int>(2);
 
-    return globals::timerSystem.CreateTimer(interval, callback, flags);
+    if (!callback) {
+        script_context.ThrowNativeError("Invalid timer callback");
+        return nullptr;
+    }
+
+    return reinterpret_cast<void *>(globals::timerSystem.CreateTimer(interval, callback, flags));
+}
+
+void *CreateTickTimer(ScriptContext &script_context) {
+    auto ticks = script_context.GetArgument<int>(0);
+    auto callback = script_context.GetArgument<CallbackT>(1);
+    auto flags = script_context.GetArgument<int>(2);
+
+    if (!callback) {
+        script_context.ThrowNativeError("Invalid timer callback");
+        return nullptr;
+    }
+
+    return reinterpret_cast<void *>(globals::timerSystem.CreateTickTimer(ticks, callback, flags));
 }
 
 void KillTimer(ScriptContext &script_context) {
-    auto timer = script_context.GetArgument<timers::Timer *>(0);
-    globals::timerSystem.KillTimer(timer);
+    auto timer = script_context.GetArgument<void *>(0);
+    globals::timerSystem.KillTimer(reinterpret_cast<uintptr_t>(timer));
 }
 
 REGISTER_NATIVES(timers, {
     ScriptEngine::RegisterNativeHandler("CREATE_TIMER", CreateTimer);
+    ScriptEngine::RegisterNativeHandler("CREATE_TICK_TIMER", CreateTickTimer);
     ScriptEngine::RegisterNativeHandler("KILL_TIMER", KillTimer);
 })
 }  // namespace counterstrikesharp
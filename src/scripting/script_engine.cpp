@@ -27,11 +27,15 @@
 
 #include <stack>
 #include <unordered_map>
+#include <vector>
 
 #include "core/log.h"
 #include "core/utils.h"
 
-static std::unordered_map<uint64_t, counterstrikesharp::TNativeHandler> g_registeredHandlers;
+// Natives live in a dense table indexed by slot; the hash map is only consulted
+// when resolving a name hash to its slot.
+static std::vector<counterstrikesharp::NativeEntry> g_nativeTable;
+static std::unordered_map<uint64_t, uint32_t> g_nativeSlots;
 
 namespace counterstrikesharp {
 
@@ -59,41 +63,54 @@ void ScriptContext::Reset() {
         errors.pop();
     }
 
+    // Only the slots pushed since the last reset can be dirty.
+    auto used = std::min(std::max(m_numArguments, m_native_context->numArguments), (int)MaxArguments);
+    if (used > 0) {
+        memset(m_native_context->arguments, 0, used * ArgumentSize);
+    }
+
     m_numResults = 0;
     m_numArguments = 0;
+    m_native_context->numArguments = 0;
     *m_has_error = 0;
 
-    for (int i = 0; i < 32; i++) {
-        m_native_context->arguments[i] = 0;
-    }
-
     m_native_context->result = 0;
 }
 
-tl::optional<TNativeHandler> ScriptEngine::GetNativeHandler(uint64_t nativeIdentifier) {
-    auto it = g_registeredHandlers.find(nativeIdentifier);
+const NativeEntry *ScriptEngine::GetNativeEntry(uint64_t nativeIdentifier) {
+    if (nativeIdentifier & kNativeSlotTag) {
+        auto slot = static_cast<uint32_t>(nativeIdentifier);
 
-    if (it != g_registeredHandlers.end()) {
-        return it->second;
+        if (slot < g_nativeTable.size()) {
+            return &g_nativeTable[slot];
+        }
+
+        return nullptr;
     }
 
-    return tl::optional<TNativeHandler>();
+    auto it = g_nativeSlots.find(nativeIdentifier);
+
+    if (it != g_nativeSlots.end()) {
+        return &g_nativeTable[it->second];
+    }
+
+    return nullptr;
 }
 
-tl::optional<TNativeHandler> ScriptEngine::GetNativeHandler(std::string identifier) {
-    auto it = g_registeredHandlers.find(hash_string(identifier.c_str()));
+uint64_t ScriptEngine::ResolveNative(uint64_t nativeIdentifier) {
+    auto it = g_nativeSlots.find(nativeIdentifier);
 
-    if (it != g_registeredHandlers.end()) {
-        return it->second;
+    if (it == g_nativeSlots.end()) {
+        return 0;
     }
 
-    return tl::optional<TNativeHandler>();
+    return kNativeSlotTag | it->second;
 }
 
 bool ScriptEngine::CallNativeHandler(uint64_t nativeIdentifier, ScriptContext &context) {
-    auto h = GetNativeHandler(nativeIdentifier);
-    if (h) {
-        (*h)(context);
+    auto entry = GetNativeEntry(nativeIdentifier);
+    if (entry) {
+        entry->invoker(entry->function, context);
 
         return true;
     }
@@ -101,20 +118,30 @@ bool ScriptEngine::CallNativeHandler(uint64_t nativeIdentifier, ScriptContext &c
     return false;
 }
 
-void ScriptEngine::RegisterNativeHandlerInt(uint64_t nativeIdentifier, TNativeHandler function) {
-    g_registeredHandlers[nativeIdentifier] = function;
+uint32_t ScriptEngine::RegisterNativeHandlerInt(uint64_t nativeIdentifier,
+                                                TNativeFunction function,
+                                                TNativeInvoker invoker) {
+    auto it = g_nativeSlots.find(nativeIdentifier);
+
+    if (it != g_nativeSlots.end()) {
+        g_nativeTable[it->second] = {nativeIdentifier, function, invoker};
+        return it->second;
+    }
+
+    auto slot = static_cast<uint32_t>(g_nativeTable.size());
+    g_nativeTable.push_back({nativeIdentifier, function, invoker});
+    g_nativeSlots[nativeIdentifier] = slot;
+
+    return slot;
 }
 
 void ScriptEngine::InvokeNative(counterstrikesharp::fxNativeContext &context) {
     if (context.nativeIdentifier == 0) return;
 
-    auto nativeHandler =
-        counterstrikesharp::ScriptEngine::GetNativeHandler(context.nativeIdentifier);
+    auto entry = GetNativeEntry(context.nativeIdentifier);
 
-    if (nativeHandler) {
-        counterstrikesharp::ScriptContextRaw scriptContext(context);
-
-        (*nativeHandler)(scriptContext);
+    if (entry) {
+        InvokeNative(*entry, context);
     } else {
         CSSHARP_CORE_WARN("Native Handler was requested but not found: {0:x}",
                           context.nativeIdentifier);
@@ -122,6 +149,13 @@ void ScriptEngine::InvokeNative(counterstrikesharp::fxNativeContext &context) {
     }
 }
 
+void ScriptEngine::InvokeNative(const NativeEntry &entry,
+                                counterstrikesharp::fxNativeContext &context) {
+    counterstrikesharp::ScriptContextRaw scriptContext(context);
+
+    entry.invoker(entry.function, scriptContext);
+}
+
 ScriptContextRaw ScriptEngine::m_context;
 
 }  // namespace counterstrikesharp
@@ -29,7 +29,6 @@
 #include <cstring>
 #include <functional>
 #include <stdexcept>
-#include <tl/optional.hpp>
 
 namespace counterstrikesharp {
 
@@ -221,39 +220,64 @@ public:
     }
 };
 
-using TNativeHandler = std::function<void(ScriptContext &)>;
+typedef void (*TNativeFunction)();
+typedef void (*TNativeInvoker)(TNativeFunction function, ScriptContext &context);
 
 template <typename T>
 using TypedTNativeHandler = T(ScriptContext &);
 
+/**
+ * Identifiers returned by ScriptEngine::ResolveNative carry this tag, with the
+ * dense slot of the native in the lower 32 bits. Untagged identifiers are the
+ * plain name hashes and still go through the hash lookup.
+ */
+constexpr uint64_t kNativeSlotTag = 1ull << 63;
+
+struct NativeEntry {
+    uint64_t identifier;
+    TNativeFunction function;
+    TNativeInvoker invoker;
+};
+
 class ScriptEngine {
 public:
-    static tl::optional<TNativeHandler> GetNativeHandler(uint64_t nativeIdentifier);
-    static tl::optional<TNativeHandler> GetNativeHandler(std::string name);
+    static const NativeEntry *GetNativeEntry(uint64_t nativeIdentifier);
+    static uint64_t ResolveNative(uint64_t nativeIdentifier);
 
     static bool CallNativeHandler(uint64_t nativeIdentifier, ScriptContext &context);
 
-    static void RegisterNativeHandlerInt(uint64_t nativeIdentifier, TNativeHandler function);
+    static uint32_t RegisterNativeHandlerInt(uint64_t nativeIdentifier,
+                                             TNativeFunction function,
+                                             TNativeInvoker invoker);
 
     template <typename T>
     static void RegisterNativeHandler(const char *nativeName, TypedTNativeHandler<T> function) {
-        auto lambda = [=](counterstrikesharp::ScriptContext &context) {
-            auto value = function(context);
-            if (!context.HasError()) {
-                context.SetResult(value);
-            }
-        };
-
-        RegisterNativeHandlerInt(hash_string(nativeName), lambda);
+        RegisterNativeHandlerInt(hash_string(nativeName),
+                                 reinterpret_cast<TNativeFunction>(function),
+                                 &InvokeTypedHandler<T>);
     }
 
     static void RegisterNativeHandler(const char *nativeName, TypedTNativeHandler<void> function) {
-        RegisterNativeHandlerInt(hash_string(nativeName), function);
+        RegisterNativeHandlerInt(hash_string(nativeName),
+                                 reinterpret_cast<TNativeFunction>(function), &InvokeVoidHandler);
     }
 
     static void InvokeNative(counterstrikesharp::fxNativeContext &context);
+    static void InvokeNative(const NativeEntry &entry, counterstrikesharp::fxNativeContext &context);
 
 private:
+    template <typename T>
+    static void InvokeTypedHandler(TNativeFunction function, ScriptContext &context) {
+        auto value = reinterpret_cast<TypedTNativeHandler<T> *>(function)(context);
+        if (!context.HasError()) {
+            context.SetResult(value);
+        }
+    }
+
+    static void InvokeVoidHandler(TNativeFunction function, ScriptContext &context) {
+        reinterpret_cast<TypedTNativeHandler<void> *>(function)(context);
+    }
+
     static ScriptContextRaw m_context;
 };
 }  // namespace counterstrikesharp
@@ -98,10 +98,11 @@ public partial class Generators
                 return $@"
                 
                 {(!string.IsNullOrEmpty(key.Comment) ? "// " + key.Comment : "")}
+                private static readonly GameEventKey _key{propertyName} = new(""{key.Name}"");
                 public {key.MappedType} {propertyName} 
                 {{
-                    get => Get<{key.MappedType}>(""{key.Name}"");
-                    set => Set<{key.MappedType}>(""{key.Name}"", value);
+                    get => Get<{key.MappedType}>(_key{propertyName});
+                    set => Set<{key.MappedType}>(_key{propertyName}, value);
                 }}";
             });
             return $@"
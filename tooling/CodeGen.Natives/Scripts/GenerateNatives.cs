@@ -49,7 +49,10 @@ public partial class Generators
                 native.Arguments.Select(pair => $"{Mapping.GetCSharpType(pair.Value)} {pair.Key}"));
 
             var hasGenerics = native.ReturnType == "any" || native.Arguments.Any(pair => pair.Value == "any");
+            var identifierField = $"_{native.Name.ToCamelCase()}Identifier";
             var returnStr = new StringBuilder($@"
+        private static ulong {identifierField};
+
         public static {Mapping.GetCSharpType(native.ReturnType)} {native.NameCamelCase}{(hasGenerics ? "<T>" : "")}({arguments}){{
 ");
 
@@ -72,7 +75,7 @@ public partial class Generators
             }
 
             returnStr.Append(
-                $"\t\t\tScriptContext.GlobalScriptContext.SetIdentifier({$"0x{native.Hash:X}"});\n");
+                $"\t\t\tScriptContext.GlobalScriptContext.SetIdentifier(ScriptContext.ResolveIdentifier(ref {identifierField}, {$"0x{native.Hash:X}"}));\n");
             returnStr.Append("\t\t\tScriptContext.GlobalScriptContext.Invoke();\n");
             returnStr.Append("\t\t\tScriptContext.GlobalScriptContext.CheckErrors();\n");
 